@@ -1,36 +1,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "lenv.c"
+#include "builtin.h"
+#include "vm.h"
+#include "reader.h"
+#include "cache.h"
+#include "jit.h"
+#include "lispy_tables.h"
 
-#ifdef _WIN32
-
-static char buffer[2048];
-
-char* readline(char* prompt) {
-  fputs(prompt, stdout);
-  fgets(buffer, 2048, stdin);
-  char* cpy = malloc(strlen(buffer)+1);
-  strcpy(cpy, buffer);
-  cpy[strlen(cpy)-1] = '\0';
-  return cpy;
-}
-
-// Records the history of inputs so that they can be retrieved with up and down arrows
-void add_history(char* unused) {}
-
-#else
-#include <editline/readline.h>
-#include <editline/history.h>
-#endif
-
-lval* builtin_add(lenv* e, lval* a) { return builtin_op(e, a, "+"); }
-lval* builtin_sub(lenv* e, lval* a) { return builtin_op(e, a, "-"); }
-lval* builtin_mul(lenv* e, lval* a) { return builtin_op(e, a, "*"); }
-lval* builtin_div(lenv* e, lval* a) { return builtin_op(e, a, "/"); }
+lval* builtin_add(lisp_vm* vm, lenv* e, lval* a) { return builtin_op(vm, e, a, "+"); }
+lval* builtin_sub(lisp_vm* vm, lenv* e, lval* a) { return builtin_op(vm, e, a, "-"); }
+lval* builtin_mul(lisp_vm* vm, lenv* e, lval* a) { return builtin_op(vm, e, a, "*"); }
+lval* builtin_div(lisp_vm* vm, lenv* e, lval* a) { return builtin_op(vm, e, a, "/"); }
 
 // Adds built-in variables into the environment
-lval* builtin_var(lenv* e, lval* a, char* func) {
+lval* builtin_var(lisp_vm* vm, lenv* e, lval* a, char* func) {
   LASSERT_TYPE(func, a, 0, LVAL_QEXPR);
   
   lval* syms = a->cell[0];
@@ -55,18 +39,304 @@ lval* builtin_var(lenv* e, lval* a, char* func) {
       lenv_put(e, syms->cell[i], a->cell[i+1]);
     } 
   }
+  // New bindings may shadow or replace a global that was inlined
+  vm->epoch++;
   lval_del(a);
   return lval_sexpr();
 }
 
 // Make functions act like a built-in
-lval* builtin_def(lenv* e, lval* a) {
-  return builtin_var(e, a, "def");
+lval* builtin_def(lisp_vm* vm, lenv* e, lval* a) {
+  return builtin_var(vm, e, a, "def");
 }
 
 // Put the built-in's into the environment
-lval* builtin_put(lenv* e, lval* a) {
-  return builtin_var(e, a, "=");
+lval* builtin_put(lisp_vm* vm, lenv* e, lval* a) {
+  return builtin_var(vm, e, a, "=");
+}
+
+// Compares the ordering of two numbers
+lval* builtin_ord(lisp_vm* vm, lenv* e, lval* a, char* op) {
+  LASSERT_NUM(op, a, 2);
+  LASSERT_TYPE(op, a, 0, LVAL_NUM);
+  LASSERT_TYPE(op, a, 1, LVAL_NUM);
+  
+  int r = 0;
+  if      (strcmp(op, ">")  == 0) { r = (a->cell[0]->num >  a->cell[1]->num); }
+  else if (strcmp(op, "<")  == 0) { r = (a->cell[0]->num <  a->cell[1]->num); }
+  else if (strcmp(op, ">=") == 0) { r = (a->cell[0]->num >= a->cell[1]->num); }
+  else if (strcmp(op, "<=") == 0) { r = (a->cell[0]->num <= a->cell[1]->num); }
+  lval_del(a);
+  return lval_num(r);
+}
+
+lval* builtin_gt(lisp_vm* vm, lenv* e, lval* a) { return builtin_ord(vm, e, a, ">");  }
+lval* builtin_lt(lisp_vm* vm, lenv* e, lval* a) { return builtin_ord(vm, e, a, "<");  }
+lval* builtin_ge(lisp_vm* vm, lenv* e, lval* a) { return builtin_ord(vm, e, a, ">="); }
+lval* builtin_le(lisp_vm* vm, lenv* e, lval* a) { return builtin_ord(vm, e, a, "<="); }
+
+// Compares any two values for (in)equality
+lval* builtin_cmp(lisp_vm* vm, lenv* e, lval* a, char* op) {
+  LASSERT_NUM(op, a, 2);
+  int r = 0;
+  if      (strcmp(op, "==") == 0) { r =  lval_eq(a->cell[0], a->cell[1]); }
+  else if (strcmp(op, "!=") == 0) { r = !lval_eq(a->cell[0], a->cell[1]); }
+  lval_del(a);
+  return lval_num(r);
+}
+
+lval* builtin_eq(lisp_vm* vm, lenv* e, lval* a) { return builtin_cmp(vm, e, a, "=="); }
+lval* builtin_ne(lisp_vm* vm, lenv* e, lval* a) { return builtin_cmp(vm, e, a, "!="); }
+
+// Evaluates one of two Q-Expressions depending on a condition
+lval* builtin_if(lisp_vm* vm, lenv* e, lval* a) {
+  LASSERT_NUM("if", a, 3);
+  LASSERT_TYPE("if", a, 0, LVAL_NUM);
+  LASSERT_TYPE("if", a, 1, LVAL_QEXPR);
+  LASSERT_TYPE("if", a, 2, LVAL_QEXPR);
+  
+  // Mark both expressions as evaluable
+  lval* x;
+  a->cell[1]->type = LVAL_SEXPR;
+  a->cell[2]->type = LVAL_SEXPR;
+  
+  // If condition is true evaluate first expression, otherwise second
+  if (a->cell[0]->num) {
+    x = lval_eval(vm, e, lval_pop(a, 1));
+  } else {
+    x = lval_eval(vm, e, lval_pop(a, 2));
+  }
+  
+  lval_del(a);
+  return x;
+}
+
+// Reads every expression of a file through the mpc grammar, from the source if it could
+// be read or else letting mpc report why it cannot
+lval* lval_read_mpc(lisp_vm* vm, char* path, char* source, size_t len) {
+
+  // The grammar is only built once something actually needs parsing
+  if (!vm->Lispy) {
+    lval* err = lispy_new(vm);
+    if (err) { return err; }
+  }
+
+  // Parse File given by string name
+  mpc_result_t r;
+  int ok = source ? mpc_nparse(path, source, len, vm->Lispy, &r)
+    : mpc_parse_contents(path, vm->Lispy, &r);
+
+  if (ok) {
+    lval* expr = lval_read(vm, r.output);
+    mpc_ast_delete(r.output);
+    return expr;
+  }
+
+  // Get Parse Error as String
+  char* err_msg = mpc_err_string(r.error);
+  mpc_err_delete(r.error);
+  lval* err = lval_err("Could not load Library %s", err_msg);
+  free(err_msg);
+  return err;
+}
+
+// Evaluates an expression being loaded. Errors are printed, unless stopping at the first
+// error, in which case it is handed back instead.
+lval* lval_load_eval(lisp_vm* vm, lenv* e, lval* x, int stop) {
+  x = lval_eval(vm, e, x);
+  if (x->type == LVAL_ERR && stop) { return x; }
+  if (x->type == LVAL_ERR) { lval_println(x); }
+  lval_del(x);
+  return NULL;
+}
+
+// Loads and evaluates every expression of a source file. Expressions are read, evaluated
+// and freed one at a time, from the file's cache if it is unchanged. Returns an error if
+// the file cannot be read, or if `stop` is set and an expression evaluates to an error.
+lval* lval_load(lisp_vm* vm, lenv* e, char* path, int stop) {
+  // The source is read straight out of a mapping of the file
+  lmap src;
+  char* source = lval_map(&src, path) ? src.data : NULL;
+  size_t len = source ? src.len : 0;
+  char* cache = lval_cache_path(path);
+  unsigned long hash = source ? lval_hash_bytes(source, len) : 0;
+  lval* err = NULL;
+
+  // Evaluate straight from the cache when it matches the source
+  long done = 0;
+  lcache_in in;
+  int cached = source && lval_cache_open(&in, cache, hash);
+  if (cached) {
+    for (lval* x; !err && (x = lval_cache_next(&in)); done++) {
+      err = lval_load_eval(vm, e, x, stop);
+    }
+    cached = lval_cache_close(&in) || err;
+  }
+
+  // Otherwise read the source, skipping anything a corrupt cache already evaluated,
+  // and write a fresh cache along the way
+  if (!cached) {
+    lcache_out out;
+    int caching = source && lval_cache_begin(&out, cache, hash);
+
+    if (source && !vm->use_mpc) {
+      lreader r;
+      lread_init_parallel(&r, path, source, len, vm->read_threads);
+      for (long i = 0; !err; i++) {
+        lval* x = lread_next(&r);
+        if (!x) { break; }
+        if (r.failed) {
+          err = lval_err("Could not load Library %s", x->err);
+          lval_del(x);
+          break;
+        }
+        if (caching) { lval_cache_add(&out, x); }
+        if (i < done) { lval_del(x); } else { err = lval_load_eval(vm, e, x, stop); }
+      }
+      lread_free(&r);
+
+    } else {
+      lval* expr = lval_read_mpc(vm, path, source, len);
+      if (expr->type == LVAL_ERR) {
+        err = expr;
+      } else {
+        // Evaluate in place rather than popping, which would move the rest each time
+        int i = 0;
+        for (; i < expr->count && !err; i++) {
+          if (caching) { lval_cache_add(&out, expr->cell[i]); }
+          if (i < done) { lval_del(expr->cell[i]); } else { err = lval_load_eval(vm, e, expr->cell[i], stop); }
+        }
+        for (; i < expr->count; i++) { lval_del(expr->cell[i]); }
+        expr->count = 0;
+        lval_del(expr);
+      }
+    }
+
+    // Only a cache of the whole file is kept
+    if (caching) { lval_cache_end(&out, cache, err == NULL); }
+  }
+
+  free(cache);
+  if (source) { lval_unmap(&src); }
+  return err ? err : lval_sexpr();
+}
+
+// Evaluates every expression in a string, stopping at the first error if `stop` is set
+lval* lval_load_str(lisp_vm* vm, lenv* e, char* name, char* src, int stop) {
+  lreader r;
+  lread_init(&r, name, src, strlen(src));
+  lval* err = NULL;
+  for (lval* x; !err && (x = lread_next(&r));) {
+    err = r.failed ? x : lval_load_eval(vm, e, x, stop);
+  }
+  lread_free(&r);
+  return err ? err : lval_sexpr();
+}
+
+// Reads every expression of a source into an S-Expression, with whichever reader the
+// interpreter is set to use, or gives an error
+lval* lval_read_all(lisp_vm* vm, char* name, char* src, size_t len) {
+  return vm->use_mpc ? lval_read_mpc(vm, name, src, len) : lval_read_src(name, src, len);
+}
+
+// Evaluates each expression read by lval_read_all in turn, returning the value of the
+// last one or the first error
+lval* lval_eval_all(lisp_vm* vm, lenv* e, lval* exprs) {
+  if (exprs->type == LVAL_ERR) { return exprs; }
+
+  lval* x = lval_sexpr();
+  int i = 0;
+  while (i < exprs->count && x->type != LVAL_ERR) {
+    lval_del(x);
+    x = lval_eval(vm, e, exprs->cell[i++]);
+  }
+
+  // Free whatever was not evaluated along with the list
+  for (; i < exprs->count; i++) { lval_del(exprs->cell[i]); }
+  exprs->count = 0;
+  lval_del(exprs);
+  return x;
+}
+
+// Evaluates expressions from a stream as each one is completed, reading a line at a
+// time so a pipe can be evaluated while it is still being written
+lval* lval_load_stream(lisp_vm* vm, lenv* e, char* name, FILE* f, int stop) {
+  lreader r;
+  size_t len = 0;
+  size_t cap = 4096;
+  char* buf = calloc(1, cap);
+  char line[4096] = "";
+  lread_init(&r, name, buf, len);
+  r.more = 1;
+
+  lval* err = NULL;
+  while (!err) {
+    int eof = fgets(line, sizeof(line), f) == NULL;
+    size_t n = eof ? 0 : strlen(line);
+
+    // Keep what is still unread, then add the line
+    size_t unread = r.p.end - r.p.s;
+    memmove(buf, r.p.s, unread);
+    len = unread + n;
+    if (len > cap) {
+      while (len > cap) { cap *= 2; }
+      buf = realloc(buf, cap);
+    }
+    memcpy(buf + unread, line, n);
+    lread_feed(&r, buf, len);
+
+    // Only read once a whole line is in, as a literal could continue into the next piece
+    // A line starting with a NUL byte reads as empty, and is taken as a whole line
+    if (!eof && n > 0 && line[n-1] != '\n') { continue; }
+    if (eof) { r.more = 0; }
+
+    for (lval* x; !err && (x = lread_next(&r));) {
+      err = r.failed ? x : lval_load_eval(vm, e, x, stop);
+    }
+    if (eof) { break; }
+  }
+
+  lread_free(&r);
+  free(buf);
+  return err ? err : lval_sexpr();
+}
+
+// Loads and evaluates every expression of a source file
+lval* builtin_load(lisp_vm* vm, lenv* e, lval* a) {
+  LASSERT_NUM("load", a, 1);
+  LASSERT_TYPE("load", a, 0, LVAL_STR);
+  
+  lval* x = lval_load(vm, e, a->cell[0]->str, 0);
+  lval_del(a);
+  return x;
+}
+
+// Prints each argument separated by spaces
+lval* builtin_print(lisp_vm* vm, lenv* e, lval* a) {
+  
+  // Print each argument followed by a space
+  for (int i = 0; i < a->count; i++) {
+    lval_print(a->cell[i]); putchar(' ');
+  }
+  
+  // Print a newline and delete arguments
+  putchar('\n');
+  lval_del(a);
+  
+  return lval_sexpr();
+}
+
+// Constructs an error from a string
+lval* builtin_error(lisp_vm* vm, lenv* e, lval* a) {
+  LASSERT_NUM("error", a, 1);
+  LASSERT_TYPE("error", a, 0, LVAL_STR);
+  
+  // Construct Error from first argument
+  lval* err = lval_err(a->cell[0]->str);
+  
+  // Delete arguments and return
+  lval_del(a);
+  return err;
 }
 
 // Register new builtins
@@ -77,33 +347,62 @@ void lenv_add_builtin(lenv* e, char* name, lbuiltin func) {
   lval_del(k); lval_del(v);
 }
 
-void lenv_add_builtins(lenv* e) {
+// Every builtin under the name it is bound to. Functions are written to caches and
+// images by these names.
+const lbuiltin_def lbuiltins[] = {
   // Variable Functions
-  lenv_add_builtin(e, "\\",  builtin_lambda); 
-  lenv_add_builtin(e, "def", builtin_def);
-  lenv_add_builtin(e, "=",   builtin_put);
-  
-  // List Functions 
-  lenv_add_builtin(e, "list", builtin_list);
-  lenv_add_builtin(e, "head", builtin_head);
-  lenv_add_builtin(e, "tail", builtin_tail);
-  lenv_add_builtin(e, "eval", builtin_eval);
-  lenv_add_builtin(e, "join", builtin_join);
-  
-  // Mathematical Functions 
-  lenv_add_builtin(e, "+", builtin_add);
-  lenv_add_builtin(e, "-", builtin_sub);
-  lenv_add_builtin(e, "*", builtin_mul);
-  lenv_add_builtin(e, "/", builtin_div);
+  { "\\",  builtin_lambda },
+  { "def", builtin_def },
+  { "=",   builtin_put },
+
+  // List Functions
+  { "list", builtin_list },
+  { "head", builtin_head },
+  { "tail", builtin_tail },
+  { "eval", builtin_eval },
+  { "join", builtin_join },
+
+  // Mathematical Functions
+  { "+", builtin_add },
+  { "-", builtin_sub },
+  { "*", builtin_mul },
+  { "/", builtin_div },
+
+  // Comparison Functions
+  { "if", builtin_if },
+  { "==", builtin_eq },
+  { "!=", builtin_ne },
+  { ">",  builtin_gt },
+  { "<",  builtin_lt },
+  { ">=", builtin_ge },
+  { "<=", builtin_le },
+
+  // String Functions
+  { "load",  builtin_load },
+  { "error", builtin_error },
+  { "print", builtin_print },
+
+  { NULL, NULL }
+};
+
+void lenv_add_builtins(lenv* e) {
+  for (int i = 0; lbuiltins[i].name; i++) {
+    lenv_add_builtin(e, lbuiltins[i].name, lbuiltins[i].func);
+  }
 }
 
 // Calls functions within the environment (with error checking)
-lval* lval_call(lenv* e, lval* f, lval* a) {
+lval* lval_call(lisp_vm* vm, lenv* e, lval* f, lval* a) {
   
   // If builtin then simply call that
   if (f->builtin) {
-    return f->builtin(e, a);
+    return f->builtin(vm, e, a);
   }
+
+  // Hot numeric lambdas may run as native code instead
+  lval* x = jit_call(vm, e, f, a);
+  if (x) { return x; }
+  vm->stats.calls++;
   
   // Record Argument counts
   int given = a->count;
@@ -134,7 +433,7 @@ lval* lval_call(lenv* e, lval* f, lval* a) {
       
       // Next formal should be bound to remaining arguments
       lval* nsym = lval_pop(f->formals, 0);
-      lenv_put(f->env, nsym, builtin_list(e, a));
+      lenv_put(f->env, nsym, builtin_list(vm, e, a));
       lval_del(sym); lval_del(nsym);
       break;
     }
@@ -176,7 +475,7 @@ lval* lval_call(lenv* e, lval* f, lval* a) {
   // If all formals have been bound, then evaluate
   if (f->formals->count == 0) {  
     f->env->par = e;    
-    return builtin_eval(f->env, lval_add(lval_sexpr(), lval_copy(f->body)));
+    return builtin_eval(vm, f->env, lval_add(lval_sexpr(), lval_copy(f->body)));
   }
   else
   {
@@ -185,12 +484,119 @@ lval* lval_call(lenv* e, lval* f, lval* a) {
   
 }
 
+/* Inlining */
+
+// Largest lambda body, counted in lvals, that is evaluated in place at its call sites
+#define LVAL_INLINE_MAX 16
+
+// Checks a symbol is one of the formals
+int lval_inline_formal(lval* formals, char* sym) {
+  for (int i = 0; i < formals->count; i++) {
+    if (strcmp(formals->cell[i]->sym, sym) == 0) { return 1; }
+  }
+  return 0;
+}
+
+// Counts the lvals in a lambda body, stopping once it is too big to inline
+int lval_inline_size(lval* v) {
+  if (v->type != LVAL_SEXPR && v->type != LVAL_QEXPR) { return 1; }
+  int total = 1;
+  for (int i = 0; i < v->count && total <= LVAL_INLINE_MAX; i++) {
+    total += lval_inline_size(v->cell[i]);
+  }
+  return total;
+}
+
+// Decides whether a lambda's body can be evaluated in place at call sites
+int lval_inlinable(lval* f) {
+  if (f->env->count != 0 || f->formals->count == 0) { return 0; }
+
+  // Formals must be distinct plain symbols, without '&'
+  for (int i = 0; i < f->formals->count; i++) {
+    if (strcmp(f->formals->cell[i]->sym, "&") == 0) { return 0; }
+    for (int j = 0; j < i; j++) {
+      if (strcmp(f->formals->cell[i]->sym, f->formals->cell[j]->sym) == 0) { return 0; }
+    }
+  }
+
+  return lval_inline_size(f->body) <= LVAL_INLINE_MAX;
+}
+
+// Resolves the head of an S-Expression. Returns a global lambda whose body can be
+// inlined, leaving the head unevaluated, or otherwise replaces the head with a copy
+// of its binding so it is not looked up a second time.
+lval* lval_inline_find(lisp_vm* vm, lenv* e, lval* v) {
+  if (v->count < 2 || v->cell[0]->type != LVAL_SYM) { return NULL; }
+
+  lenv* owner;
+  lval* f = lenv_peek(e, v->cell[0], &owner);
+  if (!f) { return NULL; }
+
+  // Only globals are inlined, anything shadowing them is left to lval_call.
+  // Analysis is cached on the bound value, so redefining the global discards it.
+  if (!owner->par && f->type == LVAL_FUN && !f->builtin) {
+    if (f->inl < 0) { f->inl = lval_inlinable(f); }
+    if (f->inl) { return f; }
+
+    // Likewise the lambda's compiled entry, which the copies called carry along
+    if (!f->jit) { f->jit = jit_entry_of(vm, f); }
+  }
+
+  lval_del(v->cell[0]);
+  v->cell[0] = lval_copy(f);
+  return NULL;
+}
+
+// Evaluates a call to an inlinable lambda without copying it. The evaluated arguments
+// are moved into a scope under the caller's environment, where lval_call would bind
+// copies of them, and a copy of the body is evaluated there. Returns NULL, leaving the
+// arguments alone, if they do not match the formals or one is an error.
+lval* lval_inline(lisp_vm* vm, lenv* e, lval* f, lval* v) {
+  int n = f->formals->count;
+  if (v->count - 1 != n) { return NULL; }
+  for (int i = 1; i < v->count; i++) {
+    if (v->cell[i]->type == LVAL_ERR) { return NULL; }
+  }
+
+  // Formals are distinct, so each binding is new
+  lenv* scope = lenv_new();
+  scope->par = e;
+  scope->count = n;
+  scope->syms = malloc(sizeof(char*) * n);
+  scope->vals = malloc(sizeof(lval*) * n);
+  for (int i = 0; i < n; i++) {
+    scope->syms[i] = malloc(strlen(f->formals->cell[i]->sym) + 1);
+    strcpy(scope->syms[i], f->formals->cell[i]->sym);
+    scope->vals[i] = v->cell[i+1];
+  }
+  v->count = 1;
+  lval_del(v);
+
+  lval* body = lval_copy(f->body);
+  body->type = LVAL_SEXPR;
+  vm->stats.inlined++;
+  lval* x = lval_eval(vm, scope, body);
+  lenv_del(scope);
+  return x;
+}
+
 // Evaluate S-Expressions
-lval* lval_eval_sexpr(lenv* e, lval* v) {
+lval* lval_eval_sexpr(lisp_vm* vm, lenv* e, lval* v) {
   
+  // Leave the head unevaluated if it names an inlinable global
+  lval* inl = lval_inline_find(vm, e, v);
+  unsigned long epoch = vm->epoch;
+
   // Evaluate Children
-  for (int i = 0; i < v->count; i++) {
-    v->cell[i] = lval_eval(e, v->cell[i]);
+  for (int i = inl ? 1 : 0; i < v->count; i++) {
+    v->cell[i] = lval_eval(vm, e, v->cell[i]);
+  }
+
+  // Inline the call, unless evaluating the arguments rebound anything
+  if (inl) {
+    lval* x = epoch == vm->epoch ? lval_inline(vm, e, inl, v) : NULL;
+    if (x) { return x; }
+    v->cell[0] = lval_eval(vm, e, v->cell[0]);
   }
     // Error Checking
   for (int i = 0; i < v->count; i++) {
@@ -206,7 +612,7 @@ lval* lval_eval_sexpr(lenv* e, lval* v) {
 
   // Handle Single Expression
   if (v->count == 1) {
-    return lval_eval(e, lval_take(v, 0));
+    return lval_eval(vm, e, lval_take(v, 0));
   }
   
   // Ensure First Element is function after evaluation
@@ -221,19 +627,19 @@ lval* lval_eval_sexpr(lenv* e, lval* v) {
   }
   
   // Call builtin with operator to get result
-  lval* result = lval_call(e, f, v);
+  lval* result = lval_call(vm, e, f, v);
   lval_del(f);
   return result;
 }
 
 // Evaluate Special Expressions
-lval* lval_eval(lenv* e, lval* v) {
+lval* lval_eval(lisp_vm* vm, lenv* e, lval* v) {
   if (v->type == LVAL_SYM) {
     lval* x = lenv_get(e, v);
     lval_del(v);
     return x;
   }
-  if (v->type == LVAL_SEXPR) { return lval_eval_sexpr(e, v); }
+  if (v->type == LVAL_SEXPR) { return lval_eval_sexpr(vm, e, v); }
   return v;
 }
 
@@ -244,13 +650,32 @@ lval* lval_read_num(mpc_ast_t* t) {
   return errno != ERANGE ? lval_num(x) : lval_err("Invalid Number.");
 }
 
-// If tagged as parser, return contents
-lval* lval_read(mpc_ast_t* t) {
+// Read a string literal, dropping the quotes and unescaping its contents
+lval* lval_read_str(mpc_ast_t* t) {
+  // Cut off the final quote character
+  t->contents[strlen(t->contents)-1] = '\0';
+  // Copy the string missing out the first quote character
+  char* unescaped = malloc(strlen(t->contents+1)+1);
+  strcpy(unescaped, t->contents+1);
+  // Pass through the unescape function
+  unescaped = mpcf_unescape(unescaped);
+  // Construct a new lval using the string
+  lval* str = lval_str(unescaped);
+  // Free the string and return
+  free(unescaped);
+  return str;
+}
+
+// If parsed by a rule for a literal, return contents
+lval* lval_read(lisp_vm* vm, mpc_ast_t* t) {
   
-  if (strstr(t->tag, "number")) {
+  if (mpc_ast_has_rule(t, mpc_rule_id(vm->Number))) {
     return lval_read_num(t);
   }
-  if (strstr(t->tag, "symbol")) {
+  if (mpc_ast_has_rule(t, mpc_rule_id(vm->String))) {
+    return lval_read_str(t);
+  }
+  if (mpc_ast_has_rule(t, mpc_rule_id(vm->Symbol))) {
     return lval_sym(t->contents);
   }
   
@@ -258,33 +683,57 @@ lval* lval_read(mpc_ast_t* t) {
   if (strcmp(t->tag, ">") == 0) {
     x = lval_sexpr();
   } 
-  if (strstr(t->tag, "sexpr"))  {
+  if (mpc_ast_has_rule(t, mpc_rule_id(vm->Sexpr)))  {
     x = lval_sexpr();
   }
-  if (strstr(t->tag, "qexpr"))  {
+  if (mpc_ast_has_rule(t, mpc_rule_id(vm->Qexpr)))  {
     x = lval_qexpr();
   }
   
+  // Only expressions carry the expr rule, so brackets and the anchors of the root are
+  // skipped along with comments
   for (int i = 0; i < t->children_num; i++) {
-    if (strcmp(t->children[i]->contents, "(") == 0) {
-      continue;
-    }
-    if (strcmp(t->children[i]->contents, ")") == 0) {
-      continue;
-    }
-    if (strcmp(t->children[i]->contents, "}") == 0) {
-      continue;
-    }
-    if (strcmp(t->children[i]->contents, "{") == 0) {
+    if (!mpc_ast_has_rule(t->children[i], mpc_rule_id(vm->Expr))) {
       continue;
     }
-    if (strcmp(t->children[i]->tag,  "regex") == 0) {
+    if (mpc_ast_has_rule(t->children[i], mpc_rule_id(vm->Comment))) {
       continue;
     }
-    if (strstr(t->children[i]->tag, "comment")) {
-      continue;
-    }
-    x = lval_add(x, lval_read(t->children[i]));
+    x = lval_add(x, lval_read(vm, t->children[i]));
   }
   return x;
-}
\ No newline at end of file
+}
+// Builds the grammar into an interpreter's parsers from the tables lisperers-grammar
+// writes out of grammar.c, so it is never parsed or optimised at run time. Returns NULL,
+// or an error leaving the interpreter without parsers if the tables do not load.
+lval* lispy_new(lisp_vm* vm) {
+  vm->Number  = mpc_new("number");
+  vm->Symbol  = mpc_new("symbol");
+  vm->String  = mpc_new("string");
+  vm->Comment = mpc_new("comment");
+  vm->Sexpr   = mpc_new("sexpr");
+  vm->Qexpr   = mpc_new("qexpr");
+  vm->Expr    = mpc_new("expr");
+  vm->Lispy   = mpc_new("lispy");
+
+  mpc_err_t* err = mpca_tables(lispy_tables, sizeof(lispy_tables), 8,
+    vm->Number, vm->Symbol, vm->String, vm->Comment,
+    vm->Sexpr, vm->Qexpr, vm->Expr, vm->Lispy);
+  if (!err) { return NULL; }
+
+  // Only tables left over from a build of another mpc can fail to load
+  char* err_msg = mpc_err_string(err);
+  mpc_err_delete(err);
+  lval* x = lval_err("Could not load the grammar %s", err_msg);
+  free(err_msg);
+  lispy_del(vm);
+  return x;
+}
+
+// Frees an interpreter's parsers, if they were built
+void lispy_del(lisp_vm* vm) {
+  if (!vm->Lispy) { return; }
+  mpc_cleanup(8, vm->Number, vm->Symbol, vm->String, vm->Comment,
+    vm->Sexpr, vm->Qexpr, vm->Expr, vm->Lispy);
+  vm->Lispy = NULL;
+}
@@ -0,0 +1,50 @@
+#ifndef builtin_h
+#define builtin_h
+
+#include "lenv.h"
+
+lval* builtin_add(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_sub(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_mul(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_div(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_def(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_put(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_gt(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_lt(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_ge(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_le(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_eq(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_ne(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_if(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_load(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_print(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_error(lisp_vm* vm, lenv* e, lval* a);
+
+// A builtin and the name it is registered under
+typedef struct {
+  char* name;
+  lbuiltin func;
+} lbuiltin_def;
+
+// Every builtin, ending with an entry whose name is NULL
+extern const lbuiltin_def lbuiltins[];
+
+void lenv_add_builtin(lenv* e, char* name, lbuiltin func);
+void lenv_add_builtins(lenv* e);
+
+lval* lval_eval(lisp_vm* vm, lenv* e, lval* v);
+lval* lval_call(lisp_vm* vm, lenv* e, lval* f, lval* a);
+int lval_inline_formal(lval* formals, char* sym);
+
+lval* lval_read(lisp_vm* vm, mpc_ast_t* t);
+lval* lval_read_mpc(lisp_vm* vm, char* path, char* source, size_t len);
+lval* lval_read_all(lisp_vm* vm, char* name, char* src, size_t len);
+lval* lval_eval_all(lisp_vm* vm, lenv* e, lval* exprs);
+lval* lval_load(lisp_vm* vm, lenv* e, char* path, int stop);
+lval* lval_load_str(lisp_vm* vm, lenv* e, char* name, char* src, int stop);
+lval* lval_load_stream(lisp_vm* vm, lenv* e, char* name, FILE* f, int stop);
+
+lval* lispy_new(lisp_vm* vm);
+void lispy_del(lisp_vm* vm);
+
+#endif
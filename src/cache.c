@@ -0,0 +1,451 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cache.h"
+#include "lenv.h"
+#include "builtin.h"
+
+/*
+ * Serialized lvals, and the `.lspc` files `load` keeps next to each source file so it
+ * only has to parse a file again once it changes.
+ *
+ * A cache file is the magic "LSPC", the interpreter version, a hash of the source and
+ * then the expressions read from it. Each lval is a type byte followed by its payload:
+ * numbers as 8 bytes, symbols, strings and errors as a 4 byte length and their bytes,
+ * and lists as a 4 byte count and their elements. Functions are a byte saying which
+ * kind they are, then either the name of the builtin or a lambda's environment, formals
+ * and body. All integers are little endian.
+ */
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+
+void lbuf_put(lbuf* b, const void* x, size_t n) {
+  if (b->len + n > b->cap) {
+    while (b->len + n > b->cap) { b->cap = b->cap ? b->cap * 2 : 4096; }
+    b->data = realloc(b->data, b->cap);
+  }
+  memcpy(b->data + b->len, x, n);
+  b->len += n;
+}
+
+void lbuf_put_u8(lbuf* b, unsigned char x) { lbuf_put(b, &x, 1); }
+
+void lbuf_put_u32(lbuf* b, unsigned int x) {
+  unsigned char c[4] = { x, x >> 8, x >> 16, x >> 24 };
+  lbuf_put(b, c, 4);
+}
+
+void lbuf_put_u64(lbuf* b, unsigned long x) {
+  lbuf_put_u32(b, (unsigned int)x);
+  lbuf_put_u32(b, (unsigned int)(x >> 32));
+}
+
+void lbuf_put_str(lbuf* b, char* s) {
+  size_t n = strlen(s);
+  lbuf_put_u32(b, n);
+  lbuf_put(b, s, n);
+}
+
+int lcur_u8(lcur* c, unsigned char* x) {
+  if (c->end - c->p < 1) { return 0; }
+  *x = *c->p++;
+  return 1;
+}
+
+int lcur_u32(lcur* c, unsigned int* x) {
+  if (c->end - c->p < 4) { return 0; }
+  *x = c->p[0] | c->p[1] << 8 | c->p[2] << 16 | (unsigned int)c->p[3] << 24;
+  c->p += 4;
+  return 1;
+}
+
+int lcur_u64(lcur* c, unsigned long* x) {
+  unsigned int lo, hi;
+  if (!lcur_u32(c, &lo) || !lcur_u32(c, &hi)) { return 0; }
+  *x = lo | (unsigned long)hi << 32;
+  return 1;
+}
+
+// Reads a length prefixed string into a new allocation
+char* lcur_str(lcur* c) {
+  unsigned int n;
+  if (!lcur_u32(c, &n) || (size_t)(c->end - c->p) < n) { return NULL; }
+  char* s = malloc(n + 1);
+  memcpy(s, c->p, n);
+  s[n] = '\0';
+  c->p += n;
+  return s;
+}
+
+// Finds the name a builtin is registered under, or "" if it is not registered
+char* lval_builtin_name(lbuiltin f) {
+  for (int i = 0; lbuiltins[i].name; i++) {
+    if (lbuiltins[i].func == f) { return lbuiltins[i].name; }
+  }
+  return "";
+}
+
+// Finds the builtin registered under a name, or NULL if there is none
+lbuiltin lval_builtin_find(char* name) {
+  for (int i = 0; lbuiltins[i].name; i++) {
+    if (strcmp(lbuiltins[i].name, name) == 0) { return lbuiltins[i].func; }
+  }
+  return NULL;
+}
+
+// Finds the next lval inside a list or lambda to write, or NULL once all have been
+// written. A lambda's environment comes first, each value after its name, then its
+// formals and body.
+static lval* lval_write_child(lbuf* b, lval* v, int i) {
+  if (v->type != LVAL_FUN) { return i < v->count ? v->cell[i] : NULL; }
+  if (i < v->env->count) {
+    lbuf_put_str(b, v->env->syms[i]);
+    return v->env->vals[i];
+  }
+  if (i == v->env->count) { return v->formals; }
+  return i == v->env->count + 1 ? v->body : NULL;
+}
+
+// Writes an lval. Lists and lambdas being written are kept on an explicit stack rather
+// than recursing, so deeply nested expressions cannot overflow the C stack.
+void lval_write(lbuf* b, lval* v) {
+  struct { lval* v; int i; }* stack = NULL;
+  int depth = 0, cap = 0;
+
+  for (;;) {
+    if (v) {
+      lbuf_put_u8(b, v->type);
+      int open = 0;
+      switch (v->type) {
+        case LVAL_NUM: lbuf_put_u64(b, (unsigned long)v->num); break;
+        case LVAL_ERR: lbuf_put_str(b, v->err); break;
+        case LVAL_SYM: lbuf_put_str(b, v->sym); break;
+        case LVAL_STR: lbuf_put_str(b, v->str); break;
+        case LVAL_FUN:
+          lbuf_put_u8(b, v->builtin != NULL);
+          if (v->builtin) {
+            lbuf_put_str(b, lval_builtin_name(v->builtin));
+          } else {
+            lbuf_put_u32(b, v->env->count);
+            open = 1;
+          }
+          break;
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+          lbuf_put_u32(b, v->count);
+          open = 1;
+          break;
+      }
+      if (open) {
+        if (depth == cap) {
+          cap = cap ? cap * 2 : 16;
+          stack = realloc(stack, sizeof(*stack) * cap);
+        }
+        stack[depth].v = v;
+        stack[depth].i = 0;
+        depth++;
+      }
+    }
+
+    if (depth == 0) { break; }
+    v = lval_write_child(b, stack[depth - 1].v, stack[depth - 1].i++);
+    if (!v) { depth--; }
+  }
+  free(stack);
+}
+
+// A list or lambda being read back, with the parts of a lambda kept until it is whole
+typedef struct {
+  unsigned char type;
+  unsigned long n;
+  unsigned long i;
+  lval* v;
+  lenv* env;
+  char* sym;
+  lval* formals;
+} lunwrite_open;
+
+static void lunwrite_open_del(lunwrite_open* o) {
+  if (o->v) { lval_del(o->v); }
+  if (o->env) { lenv_del(o->env); }
+  if (o->formals) { lval_del(o->formals); }
+  free(o->sym);
+}
+
+// Reads an lval written by lval_write, or returns NULL if the data is malformed. Lists
+// and lambdas are filled in on an explicit stack, as lval_write walks them.
+lval* lval_unwrite(lcur* c) {
+  lunwrite_open* stack = NULL;
+  int depth = 0, cap = 0;
+
+  for (;;) {
+    // Values without anything inside come back whole, and lists and lambdas are opened
+    lval* x = NULL;
+    unsigned char type;
+    unsigned int n;
+    if (!lcur_u8(c, &type)) { goto fail; }
+    switch (type) {
+      case LVAL_NUM: {
+        unsigned long num;
+        if (!lcur_u64(c, &num)) { goto fail; }
+        x = lval_num((long)num);
+        break;
+      }
+      case LVAL_ERR:
+      case LVAL_SYM:
+      case LVAL_STR: {
+        char* str = lcur_str(c);
+        if (!str) { goto fail; }
+        x = type == LVAL_ERR ? lval_err("%s", str)
+          : type == LVAL_SYM ? lval_sym(str) : lval_str(str);
+        free(str);
+        break;
+      }
+      case LVAL_FUN: {
+        unsigned char builtin;
+        if (!lcur_u8(c, &builtin)) { goto fail; }
+        if (builtin) {
+          char* name = lcur_str(c);
+          lbuiltin f = name ? lval_builtin_find(name) : NULL;
+          free(name);
+          if (!f) { goto fail; }
+          x = lval_builtin(f);
+          break;
+        }
+      }
+      // fallthrough
+      case LVAL_SEXPR:
+      case LVAL_QEXPR: {
+        if (!lcur_u32(c, &n)) { goto fail; }
+        if (depth == cap) {
+          cap = cap ? cap * 2 : 16;
+          stack = realloc(stack, sizeof(lunwrite_open) * cap);
+        }
+        lunwrite_open* o = &stack[depth++];
+        *o = (lunwrite_open){ .type = type, .n = n };
+        if (type == LVAL_FUN) {
+          o->n += 2;
+          o->env = lenv_new();
+        } else {
+          o->v = type == LVAL_SEXPR ? lval_sexpr() : lval_qexpr();
+        }
+        break;
+      }
+      default: goto fail;
+    }
+
+    // Hand each finished value to the list or lambda it is in, closing them as they fill
+    for (;;) {
+      if (depth == 0) {
+        free(stack);
+        return x;
+      }
+      lunwrite_open* o = &stack[depth - 1];
+      if (x) {
+        if (o->type != LVAL_FUN) {
+          lval_add(o->v, x);
+        } else if (o->i < o->n - 2) {
+          lval k = { .type = LVAL_SYM, .sym = o->sym };
+          lenv_put(o->env, &k, x);
+          lval_del(x);
+          free(o->sym);
+          o->sym = NULL;
+        } else if (o->i == o->n - 2) {
+          o->formals = x;
+        } else {
+          o->v = x;
+        }
+        o->i++;
+        x = NULL;
+      }
+
+      if (o->i < o->n) {
+        if (o->type == LVAL_FUN && o->i < o->n - 2 && !(o->sym = lcur_str(c))) { goto fail; }
+        break;
+      }
+
+      if (o->type == LVAL_FUN) {
+        x = lval_lambda(o->formals, o->v);
+        lenv_del(x->env);
+        x->env = o->env;
+      } else {
+        x = o->v;
+      }
+      depth--;
+    }
+  }
+
+fail:
+  for (int i = 0; i < depth; i++) { lunwrite_open_del(&stack[i]); }
+  free(stack);
+  return NULL;
+}
+
+// FNV-1a hash of a block of bytes
+unsigned long lval_hash_bytes(const char* s, size_t n) {
+  unsigned long h = 14695981039346656037UL;
+  for (size_t i = 0; i < n; i++) { h = (h ^ (unsigned char)s[i]) * 1099511628211UL; }
+  return h;
+}
+
+// Reads a whole file into memory, returning NULL if it cannot be read
+char* lval_slurp(char* path, size_t* len) {
+  FILE* f = fopen(path, "rb");
+  if (!f) { return NULL; }
+
+  lbuf b = { NULL, 0, 0 };
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) { lbuf_put(&b, chunk, n); }
+  int failed = ferror(f);
+  fclose(f);
+
+  lbuf_put_u8(&b, 0);
+  if (failed) { free(b.data); return NULL; }
+  *len = b.len - 1;
+  return b.data;
+}
+
+// Maps a file read-only, returning 0 if it cannot be read. The data is not NUL
+// terminated. Files that cannot be mapped, such as empty files and pipes, are read with
+// lval_slurp instead.
+int lval_map(lmap* m, char* path) {
+  m->mapped = 0;
+
+#ifndef _WIN32
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) { return 0; }
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      madvise(data, st.st_size, MADV_SEQUENTIAL);
+      m->data = data;
+      m->len = st.st_size;
+      m->mapped = 1;
+    }
+  }
+  close(fd);
+  if (m->mapped) { return 1; }
+#endif
+
+  m->data = lval_slurp(path, &m->len);
+  return m->data != NULL;
+}
+
+void lval_unmap(lmap* m) {
+#ifndef _WIN32
+  if (m->mapped) { munmap(m->data, m->len); return; }
+#endif
+  free(m->data);
+}
+
+// Works out the cache file for a source file: `x.lspy` is cached as `x.lspc`,
+// anything else has `.lspc` appended
+char* lval_cache_path(char* path) {
+  size_t n = strlen(path);
+  char* cache = malloc(n + 6);
+  strcpy(cache, path);
+  if (n > 5 && strcmp(path + n - 5, ".lspy") == 0) {
+    strcpy(cache + n - 5, ".lspc");
+  } else {
+    strcat(cache, ".lspc");
+  }
+  return cache;
+}
+
+// Writes the header every cache file starts with
+void lval_cache_header(lbuf* b, unsigned long hash) {
+  lbuf_put(b, "LSPC", 4);
+  lbuf_put_str(b, LISPERERS_VERSION);
+  lbuf_put_u32(b, LISPERERS_CACHE_FORMAT);
+  lbuf_put_u64(b, hash);
+}
+
+// Opens the cache for a source, returning 0 if there is no cache for this exact source,
+// interpreter version and format
+int lval_cache_open(lcache_in* in, char* cache, unsigned long hash) {
+  if (!lval_map(&in->map, cache)) { return 0; }
+  char* data = in->map.data;
+  size_t len = in->map.len;
+
+  lbuf header = { NULL, 0, 0 };
+  lval_cache_header(&header, hash);
+  in->c = (lcur){ (unsigned char*)data, (unsigned char*)data + len };
+
+  // The header is followed by an S-Expression holding every expression
+  unsigned char type = 0;
+  int ok = len > header.len && memcmp(data, header.data, header.len) == 0;
+  if (ok) { in->c.p += header.len; }
+  ok = ok && lcur_u8(&in->c, &type) && type == LVAL_SEXPR && lcur_u32(&in->c, &in->left);
+
+  free(header.data);
+  if (!ok) { lval_unmap(&in->map); }
+  return ok;
+}
+
+// Reads the next cached expression, or returns NULL at the end or if the cache is corrupt
+lval* lval_cache_next(lcache_in* in) {
+  if (in->left == 0) { return NULL; }
+  lval* x = lval_unwrite(&in->c);
+  if (x) { in->left--; }
+  return x;
+}
+
+// Closes the cache, returning whether every expression in it was read intact
+int lval_cache_close(lcache_in* in) {
+  int ok = in->left == 0 && in->c.p == in->c.end;
+  lval_unmap(&in->map);
+  return ok;
+}
+
+// Starts writing the cache for a source, quietly returning 0 if it cannot be written
+int lval_cache_begin(lcache_out* out, char* cache, unsigned long hash) {
+  out->tmp = malloc(strlen(cache) + 32);
+  sprintf(out->tmp, "%s.%d.tmp", cache, (int)getpid());
+  out->f = fopen(out->tmp, "wb");
+  if (!out->f) { free(out->tmp); return 0; }
+
+  out->b = (lbuf){ NULL, 0, 0 };
+  out->count = 0;
+  lval_cache_header(&out->b, hash);
+  lbuf_put_u8(&out->b, LVAL_SEXPR);
+  out->count_at = out->b.len;
+  lbuf_put_u32(&out->b, 0);
+  return 1;
+}
+
+// Adds an expression to the cache being written
+void lval_cache_add(lcache_out* out, lval* v) {
+  lval_write(&out->b, v);
+  out->count++;
+
+  // Flush in blocks so the cache never needs holding in memory
+  if (out->b.len >= 65536) {
+    fwrite(out->b.data, 1, out->b.len, out->f);
+    out->b.len = 0;
+  }
+}
+
+// Finishes the cache, keeping it only if asked to and it was written in full
+void lval_cache_end(lcache_out* out, char* cache, int keep) {
+  fwrite(out->b.data, 1, out->b.len, out->f);
+  lbuf count = { NULL, 0, 0 };
+  lbuf_put_u32(&count, out->count);
+  int ok = fseek(out->f, out->count_at, SEEK_SET) == 0
+    && fwrite(count.data, 1, 4, out->f) == 4 && !ferror(out->f);
+  ok = fclose(out->f) == 0 && ok;
+
+  if (!keep || !ok || rename(out->tmp, cache) != 0) { remove(out->tmp); }
+  free(count.data);
+  free(out->b.data);
+  free(out->tmp);
+}
@@ -0,0 +1,77 @@
+#ifndef cache_h
+#define cache_h
+
+#include "lval.h"
+
+#define LISPERERS_VERSION "1.0"
+
+// Layout of caches and images. Bump it whenever lval_write changes, or the readers give
+// different lvals for the same source, so that files written by older builds are read
+// from source again. Files from before it was recorded count as format 1.
+#define LISPERERS_CACHE_FORMAT 2
+
+// Growable byte buffer lvals are written into
+typedef struct {
+  char* data;
+  size_t len;
+  size_t cap;
+} lbuf;
+
+void lbuf_put(lbuf* b, const void* x, size_t n);
+void lbuf_put_u8(lbuf* b, unsigned char x);
+void lbuf_put_u32(lbuf* b, unsigned int x);
+void lbuf_put_u64(lbuf* b, unsigned long x);
+void lbuf_put_str(lbuf* b, char* s);
+
+// Reads back from a buffer, failing once anything runs past its end
+typedef struct {
+  const unsigned char* p;
+  const unsigned char* end;
+} lcur;
+
+int lcur_u8(lcur* c, unsigned char* x);
+int lcur_u32(lcur* c, unsigned int* x);
+int lcur_u64(lcur* c, unsigned long* x);
+char* lcur_str(lcur* c);
+
+void lval_write(lbuf* b, lval* v);
+lval* lval_unwrite(lcur* c);
+
+// A whole file in memory, mapped where possible and otherwise read in
+typedef struct {
+  char* data;
+  size_t len;
+  int mapped;
+} lmap;
+
+unsigned long lval_hash_bytes(const char* s, size_t n);
+char* lval_slurp(char* path, size_t* len);
+int lval_map(lmap* m, char* path);
+void lval_unmap(lmap* m);
+
+// Cached expressions being read back one at a time
+typedef struct {
+  lmap map;
+  lcur c;
+  unsigned int left;
+} lcache_in;
+
+// Cache being written one expression at a time, under a temporary name that is renamed
+// into place once complete so a concurrent load never sees it half written
+typedef struct {
+  FILE* f;
+  char* tmp;
+  long count_at;
+  unsigned int count;
+  lbuf b;
+} lcache_out;
+
+char* lval_cache_path(char* path);
+int lval_cache_open(lcache_in* in, char* cache, unsigned long hash);
+lval* lval_cache_next(lcache_in* in);
+int lval_cache_close(lcache_in* in);
+int lval_cache_begin(lcache_out* out, char* cache, unsigned long hash);
+void lval_cache_add(lcache_out* out, lval* v);
+void lval_cache_end(lcache_out* out, char* cache, int keep);
+
+#endif
@@ -0,0 +1,375 @@
+/**
+ * lisperers-compile: translates a Lisperers script into a C program.
+ *
+ * Every top level expression becomes C that builds its lvals directly, so the compiled
+ * program never parses its source. Lambdas defined at the top level whose bodies stay
+ * within the numeric subset the JIT accepts (formals, numbers, `if`, arithmetic,
+ * comparisons and calls to themselves) are also translated into C functions and
+ * installed with jit_register, so calls to them skip evaluation altogether. Everything
+ * else, including `eval` on data built at run time, runs on the embedded interpreter.
+ *
+ * `(load "file")` with a literal file name is expanded in place at compile time.
+ *
+ * Usage: lisperers-compile script.lspy [out.c]
+ *        gcc -I src out.c src/liblisperers.a -lm -pthread -o script
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vm.h"
+#include "builtin.h"
+#include "jit.h"
+
+// Builtins, used to work out what the symbols called by a lambda refer to
+lenv* builtins;
+
+// Number of top level expressions and compiled lambdas written so far
+int forms = 0;
+int lambdas = 0;
+
+// Writes a string as a C string literal
+void emit_cstr(FILE* out, char* s) {
+  fputc('"', out);
+  for (unsigned char* c = (unsigned char*)s; *c; c++) {
+    if (*c == '"' || *c == '\\') { fprintf(out, "\\%c", *c); }
+    else if (*c < 32 || *c > 126) { fprintf(out, "\\%03o", *c); }
+    else { fputc(*c, out); }
+  }
+  fputc('"', out);
+}
+
+// Writes a C expression that constructs a copy of an lval
+void emit_lval(FILE* out, lval* v) {
+  switch (v->type) {
+    case LVAL_NUM: fprintf(out, "lval_num(%ldL)", v->num); break;
+    case LVAL_SYM: fputs("lval_sym(", out); emit_cstr(out, v->sym); fputc(')', out); break;
+    case LVAL_STR: fputs("lval_str(", out); emit_cstr(out, v->str); fputc(')', out); break;
+    case LVAL_ERR: fputs("lval_err(\"%s\", ", out); emit_cstr(out, v->err); fputc(')', out); break;
+    case LVAL_SEXPR:
+    case LVAL_QEXPR:
+      for (int i = 0; i < v->count; i++) { fputs("lval_add(", out); }
+      fputs(v->type == LVAL_SEXPR ? "lval_sexpr()" : "lval_qexpr()", out);
+      for (int i = 0; i < v->count; i++) {
+        fputs(", ", out);
+        emit_lval(out, v->cell[i]);
+        fputc(')', out);
+      }
+      break;
+  }
+}
+
+/* Numeric lambdas */
+
+typedef struct {
+  char* name;
+  int index;
+  lval* formals;
+  int nsyms;
+  char* syms[32];
+  lbuiltin funs[32];
+} lambda_info;
+
+// Records a symbol the body calls
+int note_sym(lambda_info* l, char* sym, lbuiltin fun) {
+  for (int i = 0; i < l->nsyms; i++) {
+    if (strcmp(l->syms[i], sym) == 0) { return 1; }
+  }
+  if (l->nsyms == 32 || lval_inline_formal(l->formals, sym)) { return 0; }
+  l->syms[l->nsyms] = sym;
+  l->funs[l->nsyms] = fun;
+  l->nsyms++;
+  return 1;
+}
+
+int emit_num_expr(FILE* out, lambda_info* l, lval* v);
+
+// Writes a branch of an `if`, a Q-Expression evaluated as an S-Expression
+int emit_num_branch(FILE* out, lambda_info* l, lval* v) {
+  if (v->type != LVAL_QEXPR) { return 0; }
+  v->type = LVAL_SEXPR;
+  int ok = emit_num_expr(out, l, v);
+  v->type = LVAL_QEXPR;
+  return ok;
+}
+
+// Writes an expression of the numeric subset as C, or returns 0 if it is outside it
+int emit_num_expr(FILE* out, lambda_info* l, lval* v) {
+  switch (v->type) {
+    case LVAL_NUM:
+      fprintf(out, "%ldL", v->num);
+      return 1;
+    case LVAL_SYM:
+      for (int i = 0; i < l->formals->count; i++) {
+        if (strcmp(l->formals->cell[i]->sym, v->sym) == 0) {
+          fprintf(out, "a%d", i);
+          return 1;
+        }
+      }
+      return 0;
+    case LVAL_SEXPR:
+      break;
+    default:
+      return 0;
+  }
+
+  if (v->count == 0) { return 0; }
+  if (v->count == 1) { return emit_num_expr(out, l, v->cell[0]); }
+
+  lval* head = v->cell[0];
+  if (head->type != LVAL_SYM) { return 0; }
+  int ok = 1;
+
+  // Calls to itself go straight to the C function
+  if (strcmp(head->sym, l->name) == 0) {
+    if (v->count - 1 != l->formals->count || !note_sym(l, head->sym, NULL)) { return 0; }
+    fprintf(out, "lisp_%d(vm", l->index);
+    for (int i = 1; i < v->count && ok; i++) {
+      fputs(", ", out);
+      ok = emit_num_expr(out, l, v->cell[i]);
+    }
+    fputc(')', out);
+    return ok;
+  }
+
+  lenv* owner;
+  lval* f = lenv_peek(builtins, head, &owner);
+  if (!f || !note_sym(l, head->sym, f->builtin)) { return 0; }
+  lbuiltin b = f->builtin;
+
+  if (b == builtin_if) {
+    if (v->count != 4) { return 0; }
+    fputc('(', out);
+    ok = emit_num_expr(out, l, v->cell[1]);
+    fputs(" ? ", out);
+    ok = ok && emit_num_branch(out, l, v->cell[2]);
+    fputs(" : ", out);
+    ok = ok && emit_num_branch(out, l, v->cell[3]);
+    fputc(')', out);
+    return ok;
+  }
+
+  char* op = NULL;
+  if (b == builtin_eq) { op = "=="; }
+  if (b == builtin_ne) { op = "!="; }
+  if (b == builtin_gt) { op = ">";  }
+  if (b == builtin_lt) { op = "<";  }
+  if (b == builtin_ge) { op = ">="; }
+  if (b == builtin_le) { op = "<="; }
+  if (op) {
+    if (v->count != 3) { return 0; }
+    fputs("(long)(", out);
+    ok = emit_num_expr(out, l, v->cell[1]);
+    fprintf(out, " %s ", op);
+    ok = ok && emit_num_expr(out, l, v->cell[2]);
+    fputc(')', out);
+    return ok;
+  }
+
+  if (b == builtin_add) { op = "+"; }
+  if (b == builtin_sub) { op = "-"; }
+  if (b == builtin_mul) { op = "*"; }
+  if (b == builtin_div) {
+    // Left fold through jit_div, innermost call first
+    for (int i = 2; i < v->count; i++) { fputs("jit_div(vm, ", out); }
+    ok = emit_num_expr(out, l, v->cell[1]);
+    for (int i = 2; i < v->count && ok; i++) {
+      fputs(", ", out);
+      ok = emit_num_expr(out, l, v->cell[i]);
+      fputc(')', out);
+    }
+    return ok;
+  }
+  if (!op) { return 0; }
+
+  // Unary minus negates, otherwise fold left to right
+  fputs(b == builtin_sub && v->count == 2 ? "(-" : "(", out);
+  for (int i = 1; i < v->count && ok; i++) {
+    if (i > 1) { fprintf(out, " %s ", op); }
+    ok = emit_num_expr(out, l, v->cell[i]);
+  }
+  fputc(')', out);
+  return ok;
+}
+
+// Writes a C function for a lambda bound to a global name if its body is numeric.
+// The function is first written to a scratch file so nothing is left on failure.
+void emit_lambda(FILE* out, FILE* reg, char* name, lval* formals, lval* body) {
+  if (formals->count == 0 || formals->count > JIT_ARGS) { return; }
+  for (int i = 0; i < formals->count; i++) {
+    if (formals->cell[i]->type != LVAL_SYM) { return; }
+    if (strcmp(formals->cell[i]->sym, "&") == 0) { return; }
+    for (int k = 0; k < i; k++) {
+      if (strcmp(formals->cell[i]->sym, formals->cell[k]->sym) == 0) { return; }
+    }
+  }
+
+  lambda_info l = { .name = name, .index = lambdas, .formals = formals };
+  FILE* tmp = tmpfile();
+  if (!tmp) { return; }
+
+  body->type = LVAL_SEXPR;
+  int ok = emit_num_expr(tmp, &l, body);
+  body->type = LVAL_QEXPR;
+  if (!ok) { fclose(tmp); return; }
+
+  // Prototype, so that the body can call itself
+  fprintf(out, "\n// %s\nstatic long lisp_%d(lisp_vm* vm", name, l.index);
+  for (int i = 0; i < formals->count; i++) { fprintf(out, ", long a%d", i); }
+  fputs(");\n", out);
+
+  fprintf(out, "static long lisp_%d(lisp_vm* vm", l.index);
+  for (int i = 0; i < formals->count; i++) { fprintf(out, ", long a%d", i); }
+  fputs(") {\n  return ", out);
+  rewind(tmp);
+  for (int ch; (ch = fgetc(tmp)) != EOF;) { fputc(ch, out); }
+  fclose(tmp);
+  fputs(";\n}\n", out);
+
+  // Entry point taking an argument array, unwinding to it on division by zero
+  fprintf(out, "static long lisp_%d_entry(lisp_vm* vm, long* a) {\n", l.index);
+  fputs("  if (setjmp(vm->jit->unwind)) { vm->jit->bailed = 1; return 0; }\n", out);
+  fprintf(out, "  return lisp_%d(vm", l.index);
+  for (int i = 0; i < formals->count; i++) { fprintf(out, ", a[%d]", i); }
+  fputs(");\n}\n", out);
+
+  // Registration, run before any top level expression
+  fprintf(reg, "  {\n    char* syms[] = { ");
+  for (int i = 0; i < l.nsyms; i++) { emit_cstr(reg, l.syms[i]); fputs(", ", reg); }
+  fprintf(reg, "NULL };\n    lbuiltin funs[] = { ");
+  for (int i = 0; i < l.nsyms; i++) {
+    char* fname = "NULL";
+    lbuiltin b = l.funs[i];
+    if (b == builtin_if)  { fname = "builtin_if"; }
+    if (b == builtin_eq)  { fname = "builtin_eq"; }
+    if (b == builtin_ne)  { fname = "builtin_ne"; }
+    if (b == builtin_gt)  { fname = "builtin_gt"; }
+    if (b == builtin_lt)  { fname = "builtin_lt"; }
+    if (b == builtin_ge)  { fname = "builtin_ge"; }
+    if (b == builtin_le)  { fname = "builtin_le"; }
+    if (b == builtin_add) { fname = "builtin_add"; }
+    if (b == builtin_sub) { fname = "builtin_sub"; }
+    if (b == builtin_mul) { fname = "builtin_mul"; }
+    if (b == builtin_div) { fname = "builtin_div"; }
+    fprintf(reg, "%s, ", fname);
+  }
+  fprintf(reg, "NULL };\n    jit_register(vm, ");
+  emit_lval(reg, formals);
+  fputs(",\n      ", reg);
+  emit_lval(reg, body);
+  fprintf(reg, ",\n      lisp_%d_entry, %d, syms, funs);\n  }\n", l.index, l.nsyms);
+
+  lambdas++;
+}
+
+// Looks for `(fun {name formals...} {body})` and `(def {name} (\ {formals} {body}))`
+void emit_definition(FILE* out, FILE* reg, lval* v) {
+  if (v->type != LVAL_SEXPR || v->count != 3 || v->cell[0]->type != LVAL_SYM) { return; }
+  lval* a = v->cell[1];
+  lval* b = v->cell[2];
+
+  if (strcmp(v->cell[0]->sym, "fun") == 0) {
+    if (a->type != LVAL_QEXPR || a->count < 2 || b->type != LVAL_QEXPR) { return; }
+    if (a->cell[0]->type != LVAL_SYM) { return; }
+    lval* formals = lval_copy(a);
+    lval_del(lval_pop(formals, 0));
+    emit_lambda(out, reg, a->cell[0]->sym, formals, b);
+    lval_del(formals);
+  }
+
+  if (strcmp(v->cell[0]->sym, "def") == 0) {
+    if (a->type != LVAL_QEXPR || a->count != 1 || a->cell[0]->type != LVAL_SYM) { return; }
+    if (b->type != LVAL_SEXPR || b->count != 3 || b->cell[0]->type != LVAL_SYM) { return; }
+    if (strcmp(b->cell[0]->sym, "\\") != 0) { return; }
+    if (b->cell[1]->type != LVAL_QEXPR || b->cell[2]->type != LVAL_QEXPR) { return; }
+    emit_lambda(out, reg, a->cell[0]->sym, b->cell[1], b->cell[2]);
+  }
+}
+
+// Writes a function building each top level expression of a file, expanding loads
+int emit_file(lisp_vm* vm, FILE* out, FILE* reg, char* path) {
+  mpc_result_t r;
+  if (!mpc_parse_contents(path, vm->Lispy, &r)) {
+    mpc_err_print(r.error);
+    mpc_err_delete(r.error);
+    return 0;
+  }
+  lval* expr = lval_read(vm, r.output);
+  mpc_ast_delete(r.output);
+
+  int ok = 1;
+  while (expr->count && ok) {
+    lval* x = lval_pop(expr, 0);
+
+    // Loads of a literal file name are compiled in, rather than read at run time
+    if (x->type == LVAL_SEXPR && x->count == 2 && x->cell[0]->type == LVAL_SYM
+      && strcmp(x->cell[0]->sym, "load") == 0 && x->cell[1]->type == LVAL_STR) {
+      ok = emit_file(vm, out, reg, x->cell[1]->str);
+      lval_del(x);
+      continue;
+    }
+
+    emit_definition(out, reg, x);
+    fprintf(out, "\nstatic lval* form_%d(void) {\n  return ", forms++);
+    emit_lval(out, x);
+    fputs(";\n}\n", out);
+    lval_del(x);
+  }
+
+  lval_del(expr);
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Usage: %s script.lspy [out.c]\n", argv[0]);
+    return 1;
+  }
+
+  lisp_vm* vm = lisp_vm_new();
+  lval* err = lispy_new(vm);
+  if (err) {
+    lval_println(err);
+    return 1;
+  }
+  builtins = lenv_new();
+  lenv_add_builtins(builtins);
+
+  FILE* out = argc == 3 ? fopen(argv[2], "w") : stdout;
+  FILE* reg = tmpfile();
+  if (!out || !reg) {
+    perror("lisperers-compile");
+    return 1;
+  }
+
+  fprintf(out, "/* Generated by lisperers-compile from %s */\n\n", argv[1]);
+  fputs("#include \"vm.h\"\n", out);
+  fputs("#include \"builtin.h\"\n", out);
+  fputs("#include \"jit.h\"\n", out);
+
+  int ok = emit_file(vm, out, reg, argv[1]);
+
+  // Main registers the compiled lambdas then evaluates each expression in turn
+  fputs("\nint main(int argc, char** argv) {\n", out);
+  fputs("  lisp_vm* vm = lisp_vm_new();\n", out);
+  fputs("  vm->use_jit = getenv(\"LISPERERS_NOJIT\") == NULL;\n\n", out);
+  rewind(reg);
+  for (int ch; (ch = fgetc(reg)) != EOF;) { fputc(ch, out); }
+  fclose(reg);
+
+  fprintf(out, "\n  lval* (*forms[])(void) = {");
+  for (int i = 0; i < forms; i++) { fprintf(out, i % 8 ? " form_%d," : "\n    form_%d,", i); }
+  fputs(" NULL };\n", out);
+  fputs("  for (int i = 0; forms[i]; i++) {\n", out);
+  fputs("    lval* x = lval_eval(vm, vm->env, forms[i]());\n", out);
+  fputs("    if (x->type == LVAL_ERR) { lval_println(x); }\n", out);
+  fputs("    lval_del(x);\n", out);
+  fputs("  }\n\n", out);
+  fputs("  lisp_vm_del(vm);\n", out);
+  fputs("  return 0;\n}\n", out);
+
+  if (out != stdout) { fclose(out); }
+  lenv_del(builtins);
+  lisp_vm_del(vm);
+  return ok ? 0 : 1;
+}
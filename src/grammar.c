@@ -0,0 +1,73 @@
+/**
+ * lisperers-grammar: builds the Lispy grammar with mpca_lang and writes it out as the
+ * tables in lispy_tables.h.
+ *
+ * lispy_new loads those tables into the parsers instead of parsing the grammar,
+ * optimising it and compiling its regexes each time the interpreter starts. The
+ * Makefile runs this again whenever the grammar or mpc changes.
+ *
+ * Usage: lisperers-grammar [out.h]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mpc.h"
+
+int main(int argc, char** argv) {
+  if (argc > 2) {
+    fprintf(stderr, "Usage: %s [out.h]\n", argv[0]);
+    return 1;
+  }
+
+  mpc_parser_t* Number  = mpc_new("number");
+  mpc_parser_t* Symbol  = mpc_new("symbol");
+  mpc_parser_t* String  = mpc_new("string");
+  mpc_parser_t* Comment = mpc_new("comment");
+  mpc_parser_t* Sexpr   = mpc_new("sexpr");
+  mpc_parser_t* Qexpr   = mpc_new("qexpr");
+  mpc_parser_t* Expr    = mpc_new("expr");
+  mpc_parser_t* Lispy   = mpc_new("lispy");
+
+  mpc_err_t* err = mpca_lang(MPCA_LANG_DEFAULT,
+    "                                                     \
+      number  : /-?[0-9]+/ ;                              \
+      symbol  : /[a-zA-Z0-9_+\\-*\\/\\\\=<>!&]+/ ;        \
+      string  : /\"(\\\\.|[^\"])*\"/ ;                    \
+      comment : /;[^\\r\\n]*/ ;                           \
+      sexpr   : '(' <expr>* ')' ;                         \
+      qexpr   : '{' <expr>* '}' ;                         \
+      expr    : <number>  | <symbol> | <string>           \
+              | <comment> | <sexpr>  | <qexpr> ;          \
+      lispy   : /^/ <expr>* /$/ ;                         \
+    ",
+    Number, Symbol, String, Comment, Sexpr, Qexpr, Expr, Lispy);
+
+  FILE* out = NULL;
+  if (!err) {
+    out = argc == 2 ? fopen(argv[1], "w") : stdout;
+    if (!out) {
+      perror("lisperers-grammar");
+      mpc_cleanup(8, Number, Symbol, String, Comment, Sexpr, Qexpr, Expr, Lispy);
+      return 1;
+    }
+    fputs("/* Generated by lisperers-grammar from grammar.c */\n\n", out);
+
+    // The parsers must be given in the same order to mpca_tables in lispy_new
+    err = mpca_tables_write(out, "lispy_tables", 8,
+      Number, Symbol, String, Comment, Sexpr, Qexpr, Expr, Lispy);
+  }
+
+  int ok = err == NULL;
+  if (err) {
+    mpc_err_print(err);
+    mpc_err_delete(err);
+  }
+  if (out && out != stdout) {
+    ok = fclose(out) == 0 && ok;
+    if (!ok) { remove(argv[1]); }
+  }
+
+  mpc_cleanup(8, Number, Symbol, String, Comment, Sexpr, Qexpr, Expr, Lispy);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "image.h"
+#include "cache.h"
+#include "builtin.h"
+
+/*
+ * Heap images: the global environment as it stands after loading the prelude, written
+ * out with `--dump-image` and brought back with `--image` instead of evaluating the
+ * prelude again.
+ *
+ * An image is the magic "LSPI", the interpreter version, the format of cache.h, a count
+ * of bindings and then each binding's name and value in the format of cache.c. It holds
+ * no pointers, builtins being written by name, so it can be mapped anywhere. Values are
+ * decoded from the mapping into ordinary lvals, as the rest of the interpreter owns and
+ * frees them.
+ */
+
+// Writes every binding of an environment to an image file
+int lenv_image_save(lenv* e, char* path) {
+  lbuf b = { NULL, 0, 0 };
+  lbuf_put(&b, "LSPI", 4);
+  lbuf_put_str(&b, LISPERERS_VERSION);
+  lbuf_put_u32(&b, LISPERERS_CACHE_FORMAT);
+  lbuf_put_u32(&b, e->count);
+  for (int i = 0; i < e->count; i++) {
+    lbuf_put_str(&b, e->syms[i]);
+    lval_write(&b, e->vals[i]);
+  }
+
+  FILE* f = fopen(path, "wb");
+  int ok = f && fwrite(b.data, 1, b.len, f) == b.len;
+  if (f) { ok = fclose(f) == 0 && ok; }
+  free(b.data);
+  return ok;
+}
+
+// Adds the bindings of an image to an environment, returning 0 if it is not a valid
+// image for this version
+int lenv_image_read(lenv* e, const char* data, size_t len) {
+  lcur c = { (const unsigned char*)data, (const unsigned char*)data + len };
+  if (len < 4 || memcmp(data, "LSPI", 4) != 0) { return 0; }
+  c.p += 4;
+
+  char* version = lcur_str(&c);
+  int ok = version && strcmp(version, LISPERERS_VERSION) == 0;
+  free(version);
+
+  unsigned int format = 0;
+  ok = ok && lcur_u32(&c, &format) && format == LISPERERS_CACHE_FORMAT;
+
+  unsigned int n = 0;
+  ok = ok && lcur_u32(&c, &n);
+  for (unsigned int i = 0; ok && i < n; i++) {
+    lval k = { .type = LVAL_SYM, .sym = lcur_str(&c) };
+    lval* v = k.sym ? lval_unwrite(&c) : NULL;
+    if (v) { lenv_put(e, &k, v); lval_del(v); }
+    free(k.sym);
+    ok = v != NULL;
+  }
+  return ok && c.p == c.end;
+}
+
+// Creates a global environment from an image file, or returns NULL if it cannot be
+// used. Builtins are registered first so that an image never hides newer ones.
+lenv* lenv_image_load(char* path) {
+  lenv* e = lenv_new();
+  lenv_add_builtins(e);
+  int ok = 0;
+
+  lmap m;
+  if (lval_map(&m, path)) {
+    ok = lenv_image_read(e, m.data, m.len);
+    lval_unmap(&m);
+  }
+
+  if (!ok) {
+    lenv_del(e);
+    return NULL;
+  }
+  return e;
+}
@@ -0,0 +1,10 @@
+#ifndef image_h
+#define image_h
+
+#include "lenv.h"
+
+int lenv_image_save(lenv* e, char* path);
+int lenv_image_read(lenv* e, const char* data, size_t len);
+lenv* lenv_image_load(char* path);
+
+#endif
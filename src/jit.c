@@ -0,0 +1,529 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jit.h"
+#include "builtin.h"
+
+/*
+ * Native code for hot numeric lambdas.
+ *
+ * lval_call counts calls to each lambda made with only numbers as arguments. Once a
+ * lambda has been called JIT_HOT times its body is compiled to machine code, provided it
+ * only uses its formals, number literals, `if`, arithmetic, comparisons and calls to
+ * itself. Later calls run the machine code directly when their guards hold, and anything
+ * the machine code cannot finish (division by zero, running low on stack) is handed back
+ * to the interpreter, which is safe because such bodies have no side effects. Each
+ * interpreter keeps its own table of compiled lambdas, which its code unwinds through.
+ *
+ * Machine code is only generated on x86-64 Linux; elsewhere lambdas are simply
+ * interpreted. Setting LISPERERS_NOJIT in the environment turns compilation off.
+ */
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <pthread.h>
+#define JIT_NATIVE 1
+#else
+#define JIT_NATIVE 0
+#endif
+
+// Creates the table of compiled lambdas for an interpreter
+jit_state* jit_new(void) {
+  jit_state* jit = calloc(1, sizeof(jit_state));
+  jit->full.state = JIT_FAILED;
+  return jit;
+}
+
+// Frees every entry, along with the code generated for it at run time
+void jit_del(jit_state* jit) {
+  for (int n = 0; n < JIT_MAX; n++) {
+    jit_entry* j = &jit->table[n];
+    if (!j->formals) { continue; }
+    lval_del(j->formals);
+    lval_del(j->body);
+    for (int i = 0; i < j->nsyms; i++) { free(j->syms[i]); }
+    free(j->syms);
+    free(j->funs);
+#if JIT_NATIVE
+    if (j->code_len) { munmap((void*)j->code, j->code_len); }
+#endif
+  }
+  free(jit);
+}
+
+// Hashes a value's structure, used to find the entry for a lambda
+unsigned long jit_hash(lval* v, unsigned long h) {
+  h = (h ^ v->type) * 1099511628211UL;
+  switch (v->type) {
+    case LVAL_NUM:
+      h = (h ^ (unsigned long)v->num) * 1099511628211UL;
+      break;
+    case LVAL_SYM:
+      for (char* c = v->sym; *c; c++) { h = (h ^ (unsigned char)*c) * 1099511628211UL; }
+      break;
+    case LVAL_SEXPR:
+    case LVAL_QEXPR:
+      for (int i = 0; i < v->count; i++) { h = jit_hash(v->cell[i], h); }
+      h = (h ^ v->count) * 1099511628211UL;
+      break;
+  }
+  return h;
+}
+
+// Finds or creates the entry for a lambda, or returns NULL if the table is full
+jit_entry* jit_find(lisp_vm* vm, lval* f) {
+  unsigned long h = jit_hash(f->body, jit_hash(f->formals, 14695981039346656037UL));
+  for (int n = 0; n < JIT_MAX; n++) {
+    jit_entry* j = &vm->jit->table[(h + n) % JIT_MAX];
+    if (!j->formals) {
+      j->hash = h;
+      j->formals = lval_copy(f->formals);
+      j->body = lval_copy(f->body);
+      return j;
+    }
+    if (j->hash == h && lval_eq(j->formals, f->formals) && lval_eq(j->body, f->body)) {
+      return j;
+    }
+  }
+  return NULL;
+}
+
+// Checks a global binding is the lambda an entry was made for
+int jit_is_self(jit_entry* j, lval* v) {
+  return v->type == LVAL_FUN && !v->builtin && v->env->count == 0
+    && lval_eq(v->formals, j->formals) && lval_eq(v->body, j->body);
+}
+
+// Checks the globals called by the body are still bound to what it was compiled against
+int jit_valid(lisp_vm* vm, jit_entry* j, lenv* root) {
+  if (j->epoch == vm->epoch) { return j->valid; }
+  j->epoch = vm->epoch;
+  j->valid = 1;
+  for (int i = 0; i < j->nsyms && j->valid; i++) {
+    lval k = { .type = LVAL_SYM, .sym = j->syms[i] };
+    lenv* owner;
+    lval* v = lenv_peek(root, &k, &owner);
+    if (!v) {
+      j->valid = 0;
+    } else if (j->funs[i]) {
+      j->valid = v->type == LVAL_FUN && v->builtin == j->funs[i];
+    } else {
+      j->valid = jit_is_self(j, v);
+    }
+  }
+  return j->valid;
+}
+
+// Checks no environment between the caller and the globals rebinds a symbol the body calls
+int jit_unshadowed(jit_entry* j, lenv* e) {
+  for (; e->par; e = e->par) {
+    for (int i = 0; i < e->count; i++) {
+      for (int s = 0; s < j->nsyms; s++) {
+        if (strcmp(e->syms[i], j->syms[s]) == 0) { return 0; }
+      }
+    }
+  }
+  return 1;
+}
+
+// Records a symbol the body calls, and the builtin it must be bound to
+void jit_note_sym(jit_entry* j, char* sym, lbuiltin fun) {
+  for (int i = 0; i < j->nsyms; i++) {
+    if (strcmp(j->syms[i], sym) == 0) { return; }
+  }
+  j->nsyms++;
+  j->syms = realloc(j->syms, sizeof(char*) * j->nsyms);
+  j->funs = realloc(j->funs, sizeof(lbuiltin) * j->nsyms);
+  j->syms[j->nsyms-1] = malloc(strlen(sym) + 1);
+  strcpy(j->syms[j->nsyms-1], sym);
+  j->funs[j->nsyms-1] = fun;
+}
+
+#if JIT_NATIVE
+
+/* x86-64 code generation */
+
+typedef struct {
+  unsigned char* data;
+  int len;
+  int cap;
+
+  jit_entry* j;
+  jit_state* jit;
+  lenv* root;
+  int bail;
+  int inner;
+} jit_comp;
+
+// Appends bytes to the code being generated
+void jit_emit(jit_comp* c, const void* bytes, int n) {
+  if (c->len + n > c->cap) {
+    c->cap = c->cap ? c->cap * 2 : 256;
+    c->data = realloc(c->data, c->cap);
+  }
+  memcpy(c->data + c->len, bytes, n);
+  c->len += n;
+}
+
+void jit_emit_u8(jit_comp* c, unsigned char x) { jit_emit(c, &x, 1); }
+void jit_emit_i32(jit_comp* c, int x) { jit_emit(c, &x, 4); }
+void jit_emit_u64(jit_comp* c, unsigned long x) { jit_emit(c, &x, 8); }
+
+#define JIT_EMIT(c, ...) do { \
+    unsigned char jit_bytes[] = { __VA_ARGS__ }; \
+    jit_emit(c, jit_bytes, sizeof(jit_bytes)); \
+  } while (0)
+
+// Emits a jump or call whose 32-bit displacement reaches an earlier offset
+void jit_emit_rel(jit_comp* c, int target) {
+  jit_emit_i32(c, target - (c->len + 4));
+}
+
+// Emits a forward jump, returning where its displacement is to be patched
+int jit_emit_fwd(jit_comp* c) {
+  jit_emit_i32(c, 0);
+  return c->len - 4;
+}
+
+void jit_patch(jit_comp* c, int at) {
+  int rel = c->len - (at + 4);
+  memcpy(c->data + at, &rel, 4);
+}
+
+int jit_compile_expr(jit_comp* c, lval* v);
+
+// Compiles arguments pairwise into rax and rcx, then the operation combining them
+int jit_compile_fold(jit_comp* c, lval* v, lbuiltin fun) {
+  if (fun == builtin_sub && v->count == 2) {
+    if (!jit_compile_expr(c, v->cell[1])) { return 0; }
+    JIT_EMIT(c, 0x48, 0xF7, 0xD8);                      // neg rax
+    return 1;
+  }
+
+  if (!jit_compile_expr(c, v->cell[1])) { return 0; }
+  for (int i = 2; i < v->count; i++) {
+    JIT_EMIT(c, 0x50);                                  // push rax
+    if (!jit_compile_expr(c, v->cell[i])) { return 0; }
+    JIT_EMIT(c, 0x48, 0x89, 0xC1, 0x58);                // mov rcx, rax; pop rax
+
+    if (fun == builtin_add) { JIT_EMIT(c, 0x48, 0x01, 0xC8); }         // add rax, rcx
+    if (fun == builtin_sub) { JIT_EMIT(c, 0x48, 0x29, 0xC8); }         // sub rax, rcx
+    if (fun == builtin_mul) { JIT_EMIT(c, 0x48, 0x0F, 0xAF, 0xC1); }   // imul rax, rcx
+    if (fun == builtin_div) {
+      JIT_EMIT(c, 0x48, 0x85, 0xC9, 0x0F, 0x84);        // test rcx, rcx; jz bail
+      jit_emit_rel(c, c->bail);
+      JIT_EMIT(c, 0x48, 0x99, 0x48, 0xF7, 0xF9);        // cqo; idiv rcx
+    }
+  }
+  return 1;
+}
+
+// Compiles a comparison of exactly two arguments to 0 or 1
+int jit_compile_cmp(jit_comp* c, lval* v, lbuiltin fun) {
+  if (v->count != 3) { return 0; }
+  if (!jit_compile_expr(c, v->cell[1])) { return 0; }
+  JIT_EMIT(c, 0x50);                                    // push rax
+  if (!jit_compile_expr(c, v->cell[2])) { return 0; }
+  JIT_EMIT(c, 0x48, 0x89, 0xC1, 0x58);                  // mov rcx, rax; pop rax
+  JIT_EMIT(c, 0x48, 0x39, 0xC8, 0x0F);                  // cmp rax, rcx; setcc al
+  if (fun == builtin_eq) { jit_emit_u8(c, 0x94); }
+  if (fun == builtin_ne) { jit_emit_u8(c, 0x95); }
+  if (fun == builtin_gt) { jit_emit_u8(c, 0x9F); }
+  if (fun == builtin_lt) { jit_emit_u8(c, 0x9C); }
+  if (fun == builtin_ge) { jit_emit_u8(c, 0x9D); }
+  if (fun == builtin_le) { jit_emit_u8(c, 0x9E); }
+  JIT_EMIT(c, 0xC0, 0x0F, 0xB6, 0xC0);                  // movzx eax, al
+  return 1;
+}
+
+// Compiles a branch of an `if`, which is a Q-Expression evaluated as an S-Expression
+int jit_compile_branch(jit_comp* c, lval* v) {
+  if (v->type != LVAL_QEXPR) { return 0; }
+  v->type = LVAL_SEXPR;
+  int ok = jit_compile_expr(c, v);
+  v->type = LVAL_QEXPR;
+  return ok;
+}
+
+int jit_compile_if(jit_comp* c, lval* v) {
+  if (v->count != 4) { return 0; }
+  if (!jit_compile_expr(c, v->cell[1])) { return 0; }
+  JIT_EMIT(c, 0x48, 0x85, 0xC0, 0x0F, 0x84);            // test rax, rax; jz else
+  int to_else = jit_emit_fwd(c);
+  if (!jit_compile_branch(c, v->cell[2])) { return 0; }
+  JIT_EMIT(c, 0xE9);                                    // jmp end
+  int to_end = jit_emit_fwd(c);
+  jit_patch(c, to_else);
+  if (!jit_compile_branch(c, v->cell[3])) { return 0; }
+  jit_patch(c, to_end);
+  return 1;
+}
+
+// Compiles a call of the lambda to itself, passing a pointer to its arguments
+int jit_compile_self(jit_comp* c, lval* v) {
+  int n = v->count - 1;
+  if (n != c->j->formals->count) { return 0; }
+  for (int i = n; i >= 1; i--) {
+    if (!jit_compile_expr(c, v->cell[i])) { return 0; }
+    JIT_EMIT(c, 0x50);                                  // push rax
+  }
+  JIT_EMIT(c, 0x48, 0x89, 0xE7, 0xE8);                  // mov rdi, rsp; call inner
+  jit_emit_rel(c, c->inner);
+  JIT_EMIT(c, 0x48, 0x83, 0xC4, 8 * n);                 // add rsp, 8n
+  return 1;
+}
+
+// Compiles an expression leaving its value in rax, or returns 0 if it is outside the
+// numeric subset
+int jit_compile_expr(jit_comp* c, lval* v) {
+  lval* formals = c->j->formals;
+
+  switch (v->type) {
+    case LVAL_NUM:
+      if (v->num == (int)v->num) {
+        JIT_EMIT(c, 0x48, 0xC7, 0xC0);                  // mov rax, imm32
+        jit_emit_i32(c, (int)v->num);
+      } else {
+        JIT_EMIT(c, 0x48, 0xB8);                        // movabs rax, imm64
+        jit_emit_u64(c, (unsigned long)v->num);
+      }
+      return 1;
+
+    case LVAL_SYM:
+      for (int i = 0; i < formals->count; i++) {
+        if (strcmp(formals->cell[i]->sym, v->sym) == 0) {
+          JIT_EMIT(c, 0x48, 0x8B, 0x43, 8 * i);         // mov rax, [rbx + 8i]
+          return 1;
+        }
+      }
+      return 0;
+
+    case LVAL_SEXPR:
+      break;
+
+    default:
+      return 0;
+  }
+
+  // A lone expression evaluates to its value, an empty one to ()
+  if (v->count == 0) { return 0; }
+  if (v->count == 1) { return jit_compile_expr(c, v->cell[0]); }
+
+  // Otherwise the head must name a supported builtin or the lambda itself
+  lval* head = v->cell[0];
+  if (head->type != LVAL_SYM) { return 0; }
+  if (lval_inline_formal(formals, head->sym)) { return 0; }
+
+  lenv* owner;
+  lval* f = lenv_peek(c->root, head, &owner);
+  if (!f || f->type != LVAL_FUN) { return 0; }
+  if (!f->builtin) {
+    if (!jit_is_self(c->j, f)) { return 0; }
+    jit_note_sym(c->j, head->sym, NULL);
+    return jit_compile_self(c, v);
+  }
+  jit_note_sym(c->j, head->sym, f->builtin);
+
+  lbuiltin b = f->builtin;
+  if (b == builtin_add || b == builtin_sub || b == builtin_mul || b == builtin_div) {
+    return jit_compile_fold(c, v, b);
+  }
+  if (b == builtin_eq || b == builtin_ne || b == builtin_gt
+    || b == builtin_lt || b == builtin_ge || b == builtin_le) {
+    return jit_compile_cmp(c, v, b);
+  }
+  if (b == builtin_if) {
+    return jit_compile_if(c, v);
+  }
+  return 0;
+}
+
+// Emits the entry stub, the shared bail-out path and the lambda itself
+int jit_compile_body(jit_comp* c) {
+
+  // Entry: save rbx and the stack pointer to unwind to, set the stack limit, call inner
+  // with the arguments, which come after the interpreter
+  JIT_EMIT(c, 0x53, 0x48, 0x89, 0xF7);                  // push rbx; mov rdi, rsi
+  JIT_EMIT(c, 0x48, 0xB8);                              // movabs rax, &sp
+  jit_emit_u64(c, (unsigned long)&c->jit->sp);
+  JIT_EMIT(c, 0x48, 0x89, 0x20);                        // mov [rax], rsp
+  JIT_EMIT(c, 0x48, 0x8D, 0x8C, 0x24);                  // lea rcx, [rsp - JIT_STACK]
+  jit_emit_i32(c, -JIT_STACK);
+  JIT_EMIT(c, 0x48, 0xB8);                              // movabs rax, &limit
+  jit_emit_u64(c, (unsigned long)&c->jit->limit);
+  JIT_EMIT(c, 0x48, 0x89, 0x08, 0xE8);                  // mov [rax], rcx; call inner
+  int to_inner = jit_emit_fwd(c);
+  JIT_EMIT(c, 0x5B, 0xC3);                              // pop rbx; ret
+
+  // Bail out: unwind every frame of inner and flag the call as abandoned
+  c->bail = c->len;
+  JIT_EMIT(c, 0x48, 0xB8);                              // movabs rax, &sp
+  jit_emit_u64(c, (unsigned long)&c->jit->sp);
+  JIT_EMIT(c, 0x48, 0x8B, 0x20, 0x48, 0xB8);            // mov rsp, [rax]; movabs rax, &bailed
+  jit_emit_u64(c, (unsigned long)&c->jit->bailed);
+  JIT_EMIT(c, 0xC7, 0x00, 0x01, 0x00, 0x00, 0x00);      // mov dword [rax], 1
+  JIT_EMIT(c, 0x5B, 0xC3);                              // pop rbx; ret
+
+  // Inner: rbx points at the arguments for the duration of the body
+  c->inner = c->len;
+  jit_patch(c, to_inner);
+  JIT_EMIT(c, 0x53, 0x48, 0x89, 0xFB, 0x48, 0xB8);      // push rbx; mov rbx, rdi; movabs rax, &limit
+  jit_emit_u64(c, (unsigned long)&c->jit->limit);
+  JIT_EMIT(c, 0x48, 0x3B, 0x20, 0x0F, 0x82);            // cmp rsp, [rax]; jb bail
+  jit_emit_rel(c, c->bail);
+
+  // The entry keeps its body as a Q-Expression to compare against, so compile a copy
+  lval* body = lval_copy(c->j->body);
+  body->type = LVAL_SEXPR;
+  int ok = jit_compile_expr(c, body);
+  lval_del(body);
+
+  JIT_EMIT(c, 0x5B, 0xC3);                              // pop rbx; ret
+  return ok;
+}
+
+// Names compiled code in /tmp/perf-<pid>.map so perf can symbolize it. The map is
+// shared by every interpreter in the process.
+void jit_perf_map(jit_entry* j, lenv* root, void* code, int len) {
+  static FILE* map = NULL;
+  static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+  pthread_mutex_lock(&lock);
+  if (!map) {
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+    map = fopen(path, "w");
+    if (!map) { pthread_mutex_unlock(&lock); return; }
+  }
+
+  // Use the name of the global the lambda is bound to, if any
+  char* name = "lambda";
+  for (int i = 0; i < root->count; i++) {
+    if (jit_is_self(j, root->vals[i])) { name = root->syms[i]; break; }
+  }
+  fprintf(map, "%lx %x lisp:%s\n", (unsigned long)code, len, name);
+  fflush(map);
+  pthread_mutex_unlock(&lock);
+}
+
+// Compiles an entry's body to executable memory
+int jit_compile(lisp_vm* vm, jit_entry* j, lenv* root) {
+  jit_comp c = { .j = j, .jit = vm->jit, .root = root };
+
+  // Formals must be distinct, at most JIT_ARGS, and not rebind anything the body calls
+  if (j->formals->count > JIT_ARGS) { return 0; }
+  for (int i = 0; i < j->formals->count; i++) {
+    if (strcmp(j->formals->cell[i]->sym, "&") == 0) { return 0; }
+    for (int k = 0; k < i; k++) {
+      if (strcmp(j->formals->cell[i]->sym, j->formals->cell[k]->sym) == 0) { return 0; }
+    }
+  }
+
+  int ok = jit_compile_body(&c);
+  for (int i = 0; ok && i < j->nsyms; i++) {
+    if (lval_inline_formal(j->formals, j->syms[i])) { ok = 0; }
+  }
+
+  void* code = MAP_FAILED;
+  if (ok) {
+    code = mmap(NULL, c.len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  }
+  if (code != MAP_FAILED) {
+    memcpy(code, c.data, c.len);
+    if (mprotect(code, c.len, PROT_READ | PROT_EXEC) == 0) {
+      j->code = (jit_fn)code;
+      j->code_len = c.len;
+      jit_perf_map(j, root, code, c.len);
+    } else {
+      munmap(code, c.len);
+    }
+  }
+  free(c.data);
+  return j->code != NULL;
+}
+
+#else
+
+int jit_compile(lisp_vm* vm, jit_entry* j, lenv* root) { return 0; }
+
+#endif
+
+/* Ahead-of-time compiled lambdas */
+
+// Division as done by compiled code, giving up on the call when dividing by zero
+long jit_div(lisp_vm* vm, long x, long y) {
+  if (y == 0) { longjmp(vm->jit->unwind, 1); }
+  return x / y;
+}
+
+// Installs code compiled ahead of time for a lambda, along with the symbols its
+// body calls and the builtins they must be bound to (NULL for the lambda itself)
+void jit_register(lisp_vm* vm, lval* formals, lval* body, jit_fn code,
+  int nsyms, char** syms, lbuiltin* funs) {
+  lval* f = lval_lambda(formals, body);
+  jit_entry* j = jit_find(vm, f);
+  lval_del(f);
+  if (!j || j->state == JIT_READY) { return; }
+
+  j->state = JIT_READY;
+  j->code = code;
+  for (int i = 0; i < nsyms; i++) { jit_note_sym(j, syms[i], funs[i]); }
+
+  // Bindings are checked on first use
+  j->epoch = vm->epoch - 1;
+  j->valid = 0;
+}
+
+// Gives the entry for a lambda that could be compiled, or NULL
+jit_entry* jit_entry_of(lisp_vm* vm, lval* f) {
+  if (!vm->use_jit || f->env->count != 0 || f->formals->count > JIT_ARGS) { return NULL; }
+  jit_entry* j = jit_find(vm, f);
+  return j ? j : &vm->jit->full;
+}
+
+// Runs a call to a lambda as native code if it is hot and numeric. Returns NULL,
+// leaving the arguments alone, if the interpreter should make the call instead.
+lval* jit_call(lisp_vm* vm, lenv* e, lval* f, lval* a) {
+  if (!vm->use_jit || f->env->count != 0) { return NULL; }
+
+  // The entry cached on the lambda saves hashing its body, as long as it is from this
+  // interpreter's table
+  jit_entry* j = f->jit;
+  if ((j < vm->jit->table || j >= vm->jit->table + JIT_MAX) && j != &vm->jit->full) {
+    j = NULL;
+  }
+  if (j && j->state == JIT_FAILED) { return NULL; }
+  if (a->count != f->formals->count || a->count > JIT_ARGS) { return NULL; }
+
+  long args[JIT_ARGS];
+  for (int i = 0; i < a->count; i++) {
+    if (a->cell[i]->type != LVAL_NUM) { return NULL; }
+    args[i] = a->cell[i]->num;
+  }
+
+  if (!j) { j = f->jit = jit_entry_of(vm, f); }
+  if (j->state == JIT_FAILED) { return NULL; }
+
+  lenv* root = e;
+  while (root->par) { root = root->par; }
+
+  if (j->state == JIT_COLD) {
+    if (++j->calls < JIT_HOT) { return NULL; }
+    j->state = jit_compile(vm, j, root) ? JIT_READY : JIT_FAILED;
+    j->epoch = vm->epoch;
+    j->valid = 1;
+    if (j->state == JIT_FAILED) { return NULL; }
+    vm->stats.compiled++;
+  }
+
+  // Guard against anything the body calls having been redefined or shadowed
+  if (!jit_valid(vm, j, root) || !jit_unshadowed(j, e)) { return NULL; }
+
+  vm->jit->bailed = 0;
+  long r = j->code(vm, args);
+  if (vm->jit->bailed) { return NULL; }
+
+  vm->stats.native++;
+  lval_del(a);
+  return lval_num(r);
+}
@@ -0,0 +1,71 @@
+#ifndef jit_h
+#define jit_h
+
+#include <setjmp.h>
+
+#include "vm.h"
+
+// Calls made with numeric arguments before a lambda is compiled
+#define JIT_HOT 1000
+// Lambdas tracked at once
+#define JIT_MAX 256
+// Most formals a compiled lambda may have
+#define JIT_ARGS 15
+// Stack compiled code may use before handing back to the interpreter
+#define JIT_STACK (1 << 20)
+
+enum { JIT_COLD, JIT_READY, JIT_FAILED };
+
+typedef long(*jit_fn)(lisp_vm*, long*);
+
+typedef struct jit_entry {
+  unsigned long hash;
+  lval* formals;
+  lval* body;
+  long calls;
+  int state;
+  jit_fn code;
+
+  // Size of the executable mapping holding code generated at run time, or 0 for code
+  // compiled ahead of time
+  int code_len;
+
+  // Symbols called by the body, with the builtin each must be bound to
+  // globally, or NULL where the lambda calls itself
+  int nsyms;
+  char** syms;
+  lbuiltin* funs;
+
+  // Whether those bindings held at the last epoch they were checked
+  unsigned long epoch;
+  int valid;
+} jit_entry;
+
+// Compiled lambdas of one interpreter
+typedef struct jit_state {
+  jit_entry table[JIT_MAX];
+
+  // Entry, never compiled, given to lambdas that arrive once the table is full so they
+  // are not hashed again on every call
+  jit_entry full;
+
+  // Read and written by compiled code: stack pointer to unwind to, lowest stack pointer
+  // allowed, and whether the call was abandoned
+  void* sp;
+  void* limit;
+  int bailed;
+
+  // Code generated by lisperers-compile unwinds here when it must give up on a call
+  jmp_buf unwind;
+} jit_state;
+
+jit_state* jit_new(void);
+jit_entry* jit_entry_of(lisp_vm* vm, lval* f);
+void jit_del(jit_state* jit);
+
+long jit_div(lisp_vm* vm, long x, long y);
+void jit_register(lisp_vm* vm, lval* formals, lval* body, jit_fn code,
+  int nsyms, char** syms, lbuiltin* funs);
+lval* jit_call(lisp_vm* vm, lenv* e, lval* f, lval* a);
+
+#endif
@@ -1,36 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "lval.c"
-
-#ifdef _WIN32
-
-static char buffer[2048];
-
-char* readline(char* prompt) {
-  fputs(prompt, stdout);
-  fgets(buffer, 2048, stdin);
-  char* cpy = malloc(strlen(buffer)+1);
-  strcpy(cpy, buffer);
-  cpy[strlen(cpy)-1] = '\0';
-  return cpy;
-}
-
-// Records the history of inputs so that they can be retrieved with up and down arrows
-void add_history(char* unused) {}
-
-#else
-#include <editline/readline.h>
-#include <editline/history.h>
-#endif
-
-// Struct Lisp Environment used to encode list of relationships between names and values
-struct lenv {
-  lenv* par;
-  int count;
-  char** syms;
-  lval** vals;
-};
+#include "lenv.h"
+#include "builtin.h"
 
 // Function to create the new struct fields
 lenv* lenv_new(void) {
@@ -86,6 +58,17 @@ lval* lenv_get(lenv* e, lval* k) {
   }
 }
 
+// Finds the value bound to a symbol without copying it, along with the environment it lives in
+lval* lenv_peek(lenv* e, lval* k, lenv** owner) {
+  for (int i = 0; i < e->count; i++) {
+    if (strcmp(e->syms[i], k->sym) == 0) {
+      *owner = e;
+      return e->vals[i];
+    }
+  }
+  return e->par ? lenv_peek(e->par, k, owner) : NULL;
+}
+
 // Puts values in the environment
 void lenv_put(lenv* e, lval* k, lval* v) {
   
@@ -119,27 +102,8 @@ void lenv_def(lenv* e, lval* k, lval* v) {
 
 /* Builtins Functions */
 
-#define LASSERT(args, cond, fmt, ...) \
-  if (!(cond)) { lval* err = lval_err(fmt, ##__VA_ARGS__); lval_del(args); return err; }
-
-#define LASSERT_TYPE(func, args, index, expect) \
-  LASSERT(args, args->cell[index]->type == expect, \
-    "Function '%s' passed incorrect type for argument %i. Got %s, Expected %s.", \
-    func, index, ltype_name(args->cell[index]->type), ltype_name(expect))
-
-#define LASSERT_NUM(func, args, num) \
-  LASSERT(args, args->count == num, \
-    "Function '%s' passed incorrect number of arguments. Got %i, Expected %i.", \
-    func, args->count, num)
-
-#define LASSERT_NOT_EMPTY(func, args, index) \
-  LASSERT(args, args->cell[index]->count != 0, \
-    "Function '%s' passed {} for argument %i.", func, index);
-
-lval* lval_eval(lenv* e, lval* v);
-
 // Add bulitin for lambda function that takes some list of symbols of input and represents code
-lval* builtin_lambda(lenv* e, lval* a) {
+lval* builtin_lambda(lisp_vm* vm, lenv* e, lval* a) {
   // Check two arguments, each of which are Q-Expressions
   LASSERT_NUM("\\", a, 2);
   LASSERT_TYPE("\\", a, 0, LVAL_QEXPR);
@@ -160,12 +124,12 @@ lval* builtin_lambda(lenv* e, lval* a) {
   return lval_lambda(formals, body);
 }
 
-lval* builtin_list(lenv* e, lval* a) {
+lval* builtin_list(lisp_vm* vm, lenv* e, lval* a) {
   a->type = LVAL_QEXPR;
   return a;
 }
 
-lval* builtin_head(lenv* e, lval* a) {
+lval* builtin_head(lisp_vm* vm, lenv* e, lval* a) {
   // Check assertions in head (first) input
   LASSERT_NUM("head", a, 1);
   LASSERT_TYPE("head", a, 0, LVAL_QEXPR);
@@ -177,7 +141,7 @@ lval* builtin_head(lenv* e, lval* a) {
   return v;
 }
 
-lval* builtin_tail(lenv* e, lval* a) {
+lval* builtin_tail(lisp_vm* vm, lenv* e, lval* a) {
   // Check assertions in tail (last) input
   LASSERT_NUM("tail", a, 1);
   LASSERT_TYPE("tail", a, 0, LVAL_QEXPR);
@@ -189,17 +153,17 @@ lval* builtin_tail(lenv* e, lval* a) {
   return v;
 }
 
-lval* builtin_eval(lenv* e, lval* a) {
+lval* builtin_eval(lisp_vm* vm, lenv* e, lval* a) {
   LASSERT_NUM("eval", a, 1);
   LASSERT_TYPE("eval", a, 0, LVAL_QEXPR);
   
   lval* x = lval_take(a, 0);
   x->type = LVAL_SEXPR;
-  return lval_eval(e, x);
+  return lval_eval(vm, e, x);
 }
 
 // Takes multiple arguments and join them together
-lval* builtin_join(lenv* e, lval* a) {
+lval* builtin_join(lisp_vm* vm, lenv* e, lval* a) {
   
   for (int i = 0; i < a->count; i++) {
     LASSERT_TYPE("join", a, i, LVAL_QEXPR);
@@ -217,7 +181,7 @@ lval* builtin_join(lenv* e, lval* a) {
 }
 
 // Evaluation function used to take one lval* representing all arguments to operate on
-lval* builtin_op(lenv* e, lval* a, char* op) {
+lval* builtin_op(lisp_vm* vm, lenv* e, lval* a, char* op) {
   
   // Ensure arguments are numbers
   for (int i = 0; i < a->count; i++) {
@@ -0,0 +1,49 @@
+#ifndef lenv_h
+#define lenv_h
+
+#include "lval.h"
+
+// Struct Lisp Environment used to encode list of relationships between names and values
+struct lenv {
+  lenv* par;
+  int count;
+  char** syms;
+  lval** vals;
+};
+
+lenv* lenv_new(void);
+void lenv_del(lenv* e);
+lenv* lenv_copy(lenv* e);
+lval* lenv_get(lenv* e, lval* k);
+lval* lenv_peek(lenv* e, lval* k, lenv** owner);
+void lenv_put(lenv* e, lval* k, lval* v);
+void lenv_def(lenv* e, lval* k, lval* v);
+
+/* Builtins Functions */
+
+#define LASSERT(args, cond, fmt, ...) \
+  if (!(cond)) { lval* err = lval_err(fmt, ##__VA_ARGS__); lval_del(args); return err; }
+
+#define LASSERT_TYPE(func, args, index, expect) \
+  LASSERT(args, args->cell[index]->type == expect, \
+    "Function '%s' passed incorrect type for argument %i. Got %s, Expected %s.", \
+    func, index, ltype_name(args->cell[index]->type), ltype_name(expect))
+
+#define LASSERT_NUM(func, args, num) \
+  LASSERT(args, args->count == num, \
+    "Function '%s' passed incorrect number of arguments. Got %i, Expected %i.", \
+    func, args->count, num)
+
+#define LASSERT_NOT_EMPTY(func, args, index) \
+  LASSERT(args, args->cell[index]->count != 0, \
+    "Function '%s' passed {} for argument %i.", func, index);
+
+lval* builtin_lambda(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_list(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_head(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_tail(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_eval(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_join(lisp_vm* vm, lenv* e, lval* a);
+lval* builtin_op(lisp_vm* vm, lenv* e, lval* a, char* op);
+
+#endif
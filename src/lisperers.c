@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "lisperers.h"
+#include "vm.h"
+#include "builtin.h"
+
+/*
+ * The interface for embedding, in liblisperers.so. It is a thin layer over lisp_vm:
+ * source is read with whichever reader the interpreter is set to use and evaluated with
+ * lval_eval, and prepared expressions are simply the lvals read, copied for each run.
+ */
+
+struct lisp_prepared {
+  int nparams;
+  lval** params;
+
+  // Expressions read, or the error reading them gave
+  lval* exprs;
+};
+
+void lisp_set_user(lisp_vm* vm, void* user) {
+  vm->user = user;
+}
+
+void* lisp_user(lisp_vm* vm) {
+  return vm->user;
+}
+
+lval* lisp_eval_string(lisp_vm* vm, const char* src) {
+  lval* exprs = lval_read_all(vm, "<string>", (char*)src, strlen(src));
+  return lval_eval_all(vm, vm->env, exprs);
+}
+
+lval* lisp_load(lisp_vm* vm, const char* path) {
+  return lval_load(vm, vm->env, (char*)path, 1);
+}
+
+void lisp_register_builtin(lisp_vm* vm, const char* name, lbuiltin func) {
+  lenv_add_builtin(vm->env, (char*)name, func);
+  vm->epoch++;
+}
+
+void lisp_define(lisp_vm* vm, const char* name, lval* v) {
+  lval* k = lval_sym((char*)name);
+  lenv_put(vm->env, k, v);
+  lval_del(k);
+  vm->epoch++;
+}
+
+int lisp_type(lval* v) { return v->type; }
+long lisp_number(lval* v) { return v->type == LVAL_NUM ? v->num : 0; }
+int lisp_count(lval* v) { return v->count; }
+
+const char* lisp_string(lval* v) {
+  switch (v->type) {
+    case LVAL_STR: return v->str;
+    case LVAL_SYM: return v->sym;
+    case LVAL_ERR: return v->err;
+  }
+  return NULL;
+}
+
+lval* lisp_item(lval* v, int i) {
+  return i >= 0 && i < v->count ? v->cell[i] : NULL;
+}
+
+lisp_prepared* lisp_prepare(lisp_vm* vm, const char* src, int nparams, const char** params) {
+  lisp_prepared* p = malloc(sizeof(lisp_prepared));
+  p->nparams = nparams;
+  p->params = malloc(sizeof(lval*) * (nparams ? nparams : 1));
+  for (int i = 0; i < nparams; i++) { p->params[i] = lval_sym((char*)params[i]); }
+  p->exprs = lval_read_all(vm, "<prepared>", (char*)src, strlen(src));
+  return p;
+}
+
+// Evaluates a prepared expression with its parameters bound to copies of `args`
+lval* lisp_run(lisp_vm* vm, lisp_prepared* p, lval** args) {
+  lenv* e = lenv_new();
+  e->par = vm->env;
+  for (int i = 0; i < p->nparams; i++) { lenv_put(e, p->params[i], args[i]); }
+
+  lval* x = lval_eval_all(vm, e, lval_copy(p->exprs));
+  lenv_del(e);
+  return x;
+}
+
+void lisp_prepared_del(lisp_prepared* p) {
+  for (int i = 0; i < p->nparams; i++) { lval_del(p->params[i]); }
+  free(p->params);
+  lval_del(p->exprs);
+  free(p);
+}
@@ -0,0 +1,87 @@
+#ifndef lisperers_h
+#define lisperers_h
+
+/*
+ * Interface for programs embedding the interpreter, built as liblisperers.so.
+ *
+ * Values are lvals, made with the constructors below and freed with lval_del. Any
+ * lval handed back by a function here belongs to the caller. Builtins registered by
+ * the program are called like the interpreter's own: they are given their arguments in
+ * an S-Expression they must free, and return a new lval, which may be an error.
+ *
+ * The header stands alone, leaving the interpreter's types opaque, and the library is
+ * built with hidden visibility, so these functions are all it exports.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__)
+#define LISP_API __attribute__((visibility("default")))
+#else
+#define LISP_API
+#endif
+
+typedef struct lval lval;
+typedef struct lenv lenv;
+typedef struct lisp_vm lisp_vm;
+
+// Builtins are passed the interpreter they run in, the calling environment and their
+// arguments
+typedef lval*(*lbuiltin)(lisp_vm*, lenv*, lval*);
+
+// Types of values, as given by lisp_type
+enum { LISP_ERR, LISP_NUM, LISP_SYM, LISP_STR,
+       LISP_FUN, LISP_SEXPR, LISP_QEXPR };
+
+// Creates an interpreter, or returns NULL if it cannot
+LISP_API lisp_vm* lisp_vm_new(void);
+LISP_API void lisp_vm_del(lisp_vm* vm);
+
+// Pointer kept for the embedding program, for its builtins to find their own state
+LISP_API void lisp_set_user(lisp_vm* vm, void* user);
+LISP_API void* lisp_user(lisp_vm* vm);
+
+// Evaluates every expression in a string or file in the global environment, returning
+// the value of the last one, or the first error
+LISP_API lval* lisp_eval_string(lisp_vm* vm, const char* src);
+LISP_API lval* lisp_load(lisp_vm* vm, const char* path);
+
+// Binds a name in the global environment to a builtin, or to a copy of a value
+LISP_API void lisp_register_builtin(lisp_vm* vm, const char* name, lbuiltin func);
+LISP_API void lisp_define(lisp_vm* vm, const char* name, lval* v);
+
+// Accessors. lisp_string gives the text of a string, symbol or error, and lisp_item
+// an element of a list, which still belongs to the list.
+LISP_API int lisp_type(lval* v);
+LISP_API long lisp_number(lval* v);
+LISP_API const char* lisp_string(lval* v);
+LISP_API int lisp_count(lval* v);
+LISP_API lval* lisp_item(lval* v, int i);
+
+// Expressions read once and evaluated many times, each time in a new environment under
+// the globals where the parameters are bound to the values given
+typedef struct lisp_prepared lisp_prepared;
+
+LISP_API lisp_prepared* lisp_prepare(lisp_vm* vm, const char* src, int nparams, const char** params);
+LISP_API lval* lisp_run(lisp_vm* vm, lisp_prepared* p, lval** args);
+LISP_API void lisp_prepared_del(lisp_prepared* p);
+
+// Values, which the functions above take and hand back. lval_add appends `x` to a list
+// and takes it over.
+LISP_API lval* lval_num(long x);
+LISP_API lval* lval_err(char* fmt, ...);
+LISP_API lval* lval_sym(char* s);
+LISP_API lval* lval_str(char* s);
+LISP_API lval* lval_sexpr(void);
+LISP_API lval* lval_qexpr(void);
+LISP_API lval* lval_add(lval* v, lval* x);
+LISP_API lval* lval_copy(lval* v);
+LISP_API void lval_del(lval* v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,69 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "mpc.h"
-
-#ifdef _WIN32
-
-static char buffer[2048];
-
-char* readline(char* prompt) {
-  fputs(prompt, stdout);
-  fgets(buffer, 2048, stdin);
-  char* cpy = malloc(strlen(buffer)+1);
-  strcpy(cpy, buffer);
-  cpy[strlen(cpy)-1] = '\0';
-  return cpy;
-}
-
-// Records the history of inputs so that they can be retrieved with up and down arrows
-void add_history(char* unused) {}
-
-#else
-#include <editline/readline.h>
-#include <editline/history.h>
-#endif
-
-// Parser Declariations 
-mpc_parser_t* Number; 
-mpc_parser_t* Symbol; 
-mpc_parser_t* String; 
-mpc_parser_t* Comment;
-mpc_parser_t* Sexpr;  
-mpc_parser_t* Qexpr;  
-mpc_parser_t* Expr; 
-mpc_parser_t* Lispy;
-
-// Forward Declarations 
-struct lval;
-struct lenv;
-typedef struct lval lval;
-typedef struct lenv lenv;
-
-// Create Enumeration of Lisp Values
-enum { LVAL_ERR, LVAL_NUM, LVAL_SYM, LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR };
-       
-typedef lval*(*lbuiltin)(lenv*, lval*);
-
-// Built our struct value "lval" (Lisp Value)
-struct lval {
-  int type;
-
-  // Basic
-  long num;
-  char* err;
-  char* sym;
-  
-  // Function
-  lbuiltin builtin;
-  lenv* env;
-  lval* formals;
-  lval* body;
-  
-  // Expression
-  int count;
-  lval** cell;
-};
+#include "lval.h"
+#include "lenv.h"
 
 // Construct pointer to a number lval
 lval* lval_num(long x) {
@@ -95,6 +34,15 @@ lval* lval_sym(char* s) {
   return v;
 }
 
+// Construct pointer to a string lval
+lval* lval_str(char* s) {
+  lval* v = malloc(sizeof(lval));
+  v->type = LVAL_STR;
+  v->str = malloc(strlen(s) + 1);
+  strcpy(v->str, s);
+  return v;
+}
+
 lval* lval_builtin(lbuiltin func) {
   lval* v = malloc(sizeof(lval));
   v->type = LVAL_FUN;
@@ -102,8 +50,6 @@ lval* lval_builtin(lbuiltin func) {
   return v;
 }
 
-lenv* lenv_new(void);
-
 // Bulid new environment for lbuiltin function
 lval* lval_lambda(lval* formals, lval* body) {
   lval* v = malloc(sizeof(lval));
@@ -118,6 +64,10 @@ lval* lval_lambda(lval* formals, lval* body) {
   // Set formals and body
   v->formals = formals;
   v->body = body;
+
+  // Whether the body can be inlined is worked out on first call
+  v->inl = -1;
+  v->jit = NULL;
   return v;  
 }
 
@@ -139,8 +89,6 @@ lval* lval_qexpr(void) {
   return v;
 }
 
-void lenv_del(lenv* e);
-
 // Deletes lval* values
 void lval_del(lval* v) {
 
@@ -155,6 +103,7 @@ void lval_del(lval* v) {
     break;
     case LVAL_ERR: free(v->err); break;
     case LVAL_SYM: free(v->sym); break;
+    case LVAL_STR: free(v->str); break;
 
     // If Special or Quotated Expression found, then delete all elements inside
     case LVAL_QEXPR:
@@ -168,8 +117,6 @@ void lval_del(lval* v) {
   free(v);
 }
 
-lenv* lenv_copy(lenv* e);
-
 // Copies an lval for putting things into and out of the environment (numbers and functions)
 lval* lval_copy(lval* v) {
   lval* x = malloc(sizeof(lval));
@@ -185,6 +132,8 @@ lval* lval_copy(lval* v) {
         x->env = lenv_copy(v->env);
         x->formals = lval_copy(v->formals);
         x->body = lval_copy(v->body);
+        x->inl = -1;
+        x->jit = v->jit;
       }
     break;
 
@@ -200,6 +149,9 @@ lval* lval_copy(lval* v) {
     case LVAL_SYM: x->sym = malloc(strlen(v->sym) + 1);
       strcpy(x->sym, v->sym);
     break;
+    case LVAL_STR: x->str = malloc(strlen(v->str) + 1);
+      strcpy(x->str, v->str);
+    break;
 
     // Copy lists by copying each sub-expression
     case LVAL_SEXPR:
@@ -256,58 +208,110 @@ lval* lval_take(lval* v, int i) {
   return x;
 }
 
-void lval_print(lval* v);
-
 // Print lval expressions
-void lval_print_expr(lval* v, char open, char close) {
-  putchar(open);
+void lval_print_expr(FILE* f, lval* v, char open, char close) {
+  fputc(open, f);
   for (int i = 0; i < v->count; i++) {
-    lval_print(v->cell[i]);    
+    lval_fprint(f, v->cell[i]);    
     if (i != (v->count-1)) {
-      putchar(' ');
+      fputc(' ', f);
     }
   }
-  putchar(close);
+  fputc(close, f);
 }
 
-// Print an "lval" values onto the output
-void lval_print(lval* v) {
+// Print a string lval with its escape characters restored
+void lval_print_str(FILE* f, lval* v) {
+  // Make a Copy of the string
+  char* escaped = malloc(strlen(v->str)+1);
+  strcpy(escaped, v->str);
+  // Pass it through the escape function
+  escaped = mpcf_escape(escaped);
+  // Print it between " characters
+  fprintf(f, "\"%s\"", escaped);
+  // Free the copied string
+  free(escaped);
+}
+
+// Print an "lval" values onto a stream
+void lval_fprint(FILE* f, lval* v) {
   switch (v->type) {
     case LVAL_FUN:
       if (v->builtin) {
-        printf("<builtin>");
+        fprintf(f, "<builtin>");
       } else {
-        printf("(\\ ");
-        lval_print(v->formals);
-        putchar(' ');
-        lval_print(v->body);
-        putchar(')');
+        fprintf(f, "(\\ ");
+        lval_fprint(f, v->formals);
+        fputc(' ', f);
+        lval_fprint(f, v->body);
+        fputc(')', f);
       }
     break;
     case LVAL_NUM:
-      printf("%li", v->num);
+      fprintf(f, "%li", v->num);
       break;
     case LVAL_ERR:
-      printf("Error: %s", v->err);
+      fprintf(f, "Error: %s", v->err);
       break;
     case LVAL_SYM:
-      printf("%s", v->sym);
+      fprintf(f, "%s", v->sym);
+      break;
+    case LVAL_STR:
+      lval_print_str(f, v);
       break;
     case LVAL_SEXPR:
-      lval_print_expr(v, '(', ')');
+      lval_print_expr(f, v, '(', ')');
       break;
     case LVAL_QEXPR:
-      lval_print_expr(v, '{', '}');
+      lval_print_expr(f, v, '{', '}');
       break;
   }
 }
 
+// Print an "lval" values onto the output
+void lval_print(lval* v) {
+  lval_fprint(stdout, v);
+}
+
 // Print lval followed by a newline
 void lval_println(lval* v) {
   lval_print(v);
   putchar('\n');
 }
 
+// Compare two lvals for equality
+int lval_eq(lval* x, lval* y) {
+
+  // Different types are always unequal
+  if (x->type != y->type) { return 0; }
+
+  switch (x->type) {
+    case LVAL_NUM: return (x->num == y->num);
+    case LVAL_ERR: return (strcmp(x->err, y->err) == 0);
+    case LVAL_SYM: return (strcmp(x->sym, y->sym) == 0);
+    case LVAL_STR: return (strcmp(x->str, y->str) == 0);
+
+    // Builtins compare by function, lambdas by formals and body
+    case LVAL_FUN:
+      if (x->builtin || y->builtin) {
+        return x->builtin == y->builtin;
+      } else {
+        return lval_eq(x->formals, y->formals) && lval_eq(x->body, y->body);
+      }
+
+    // Lists are equal if every element is equal
+    case LVAL_QEXPR:
+    case LVAL_SEXPR:
+      if (x->count != y->count) { return 0; }
+      for (int i = 0; i < x->count; i++) {
+        if (!lval_eq(x->cell[i], y->cell[i])) { return 0; }
+      }
+      return 1;
+    break;
+  }
+  return 0;
+}
+
 // Report type of function was expected
 char* ltype_name(int t) {
   switch(t) {
@@ -319,6 +323,8 @@ char* ltype_name(int t) {
       return "Error";
     case LVAL_SYM:
       return "Symbol";
+    case LVAL_STR:
+      return "String";
     case LVAL_SEXPR:
       return "S-Expression";
     case LVAL_QEXPR:
@@ -0,0 +1,61 @@
+#ifndef lval_h
+#define lval_h
+
+#include "mpc.h"
+#include "lisperers.h"
+
+// Forward Declarations, lval, lenv, lisp_vm and lbuiltin being declared in lisperers.h
+struct jit_entry;
+
+// Create Enumeration of Lisp Values
+enum { LVAL_ERR = LISP_ERR, LVAL_NUM = LISP_NUM, LVAL_SYM = LISP_SYM, LVAL_STR = LISP_STR,
+       LVAL_FUN = LISP_FUN, LVAL_SEXPR = LISP_SEXPR, LVAL_QEXPR = LISP_QEXPR };
+
+// Built our struct value "lval" (Lisp Value)
+struct lval {
+  int type;
+
+  // Basic
+  long num;
+  char* err;
+  char* sym;
+  char* str;
+
+  // Function
+  lbuiltin builtin;
+  lenv* env;
+  lval* formals;
+  lval* body;
+  int inl;
+
+  // Entry for the lambda in the table of compiled lambdas, once it has been looked up
+  struct jit_entry* jit;
+
+  // Expression
+  int count;
+  lval** cell;
+};
+
+lval* lval_num(long x);
+lval* lval_err(char* fmt, ...);
+lval* lval_sym(char* s);
+lval* lval_str(char* s);
+lval* lval_builtin(lbuiltin func);
+lval* lval_lambda(lval* formals, lval* body);
+lval* lval_sexpr(void);
+lval* lval_qexpr(void);
+
+void lval_del(lval* v);
+lval* lval_copy(lval* v);
+lval* lval_add(lval* v, lval* x);
+lval* lval_join(lval* x, lval* y);
+lval* lval_pop(lval* v, int i);
+lval* lval_take(lval* v, int i);
+
+void lval_print(lval* v);
+void lval_fprint(FILE* f, lval* v);
+void lval_println(lval* v);
+int lval_eq(lval* x, lval* y);
+char* ltype_name(int t);
+
+#endif
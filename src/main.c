@@ -2,13 +2,18 @@
  * Main file that receives user input and acts as a command line for our Lisperers language.
  * Current Example based on Polish Notation
  * 
- * When testing: run `gcc main.c mpc.c -ledit -lm -o main`
+ * When testing: run `make main`
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "builtin.c"
+#include "vm.h"
+#include "builtin.h"
+#include "reader.h"
+#include "cache.h"
+#include "image.h"
+#include "server.h"
 
 #ifdef _WIN32
 
@@ -31,31 +36,145 @@ void add_history(char* unused) {}
 #include <editline/history.h>
 #endif
 
+// Prints how to run the interpreter
+void usage(char* name) {
+  fprintf(stderr,
+    "Usage: %s [options] [script.lspy | -] [args...]\n"
+    "  -e EXPR            evaluate EXPR, taking any remaining arguments as args\n"
+    "  -l FILE            load FILE, in order with any -e\n"
+    "  -                  read expressions from standard input\n"
+    "  --image FILE       start from an image written by --dump-image\n"
+    "  --dump-image FILE  load the files given and save the environment to FILE\n"
+    "  --serve SOCKET     after loading, evaluate requests sent to the Unix socket SOCKET\n"
+    "  --sandbox N        with --serve, evaluate each request in one of N forked workers\n"
+    "With no script or -e, the prompt is started.\n", name);
+}
+
+// Reports an error that stops a script, returning the exit status to use
+int report(lval* x) {
+  int failed = x->type == LVAL_ERR;
+  if (failed) {
+    fflush(stdout);
+    fprintf(stderr, "Error: %s\n", x->err);
+  }
+  lval_del(x);
+  return failed;
+}
+
+// Prints what the interpreter did, when LISPERERS_STATS is set
+void report_stats(lisp_vm* vm) {
+  if (!getenv("LISPERERS_STATS")) { return; }
+  fprintf(stderr, "calls: %lu, inlined: %lu, native: %lu, compiled: %lu\n",
+    vm->stats.calls, vm->stats.inlined, vm->stats.native, vm->stats.compiled);
+}
+
 int main(int argc, char** argv) {
   
-  mpc_parser_t* Number = mpc_new("number");
-  mpc_parser_t* Symbol = mpc_new("symbol");
-  mpc_parser_t* Sexpr  = mpc_new("sexpr");
-  mpc_parser_t* Qexpr  = mpc_new("qexpr");
-  mpc_parser_t* Expr   = mpc_new("expr");
-  mpc_parser_t* Lispy  = mpc_new("lispy");
-  
-  mpca_lang(MPCA_LANG_DEFAULT,
-    "                                                     \
-      number : /-?[0-9]+/ ;                               \
-      symbol  : /[a-zA-Z0-9_+\\-*\\/\\\\=<>!&]+/ ;        \
-      sexpr  : '(' <expr>* ')' ;                          \
-      qexpr  : '{' <expr>* '}' ;                          \
-      expr   : <number> | <symbol> | <sexpr> | <qexpr> ;  \
-      lispy  : /^/ <expr>* /$/ ;                          \
-    ",
-    Number, Symbol, Sexpr, Qexpr, Expr, Lispy);
-
-  puts("Lisperers Version 1.0");
+  lisp_vm* vm = lisp_vm_new();
+  char* dump = NULL;
+  char* serve = NULL;
+  int sandbox = -1;
+  vm->use_jit = getenv("LISPERERS_NOJIT") == NULL;
+  vm->use_mpc = getenv("LISPERERS_MPC") != NULL;
+  vm->read_threads = getenv("LISPERERS_THREADS") ? atoi(getenv("LISPERERS_THREADS")) : 0;
+
+  // Libraries and expressions, in the order given, are kept as "-l"/"-e" then the value
+  char** actions = malloc(sizeof(char*) * argc * 2);
+  int nactions = 0;
+  int nexprs = 0;
+
+  // Options come before the script and its arguments
+  int i = 1;
+  for (; i < argc; i++) {
+    int has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--image") == 0 && has_value) {
+      // Start from a saved global environment instead of an empty one
+      lenv* image = lenv_image_load(argv[++i]);
+      if (!image) {
+        fprintf(stderr, "Could not load image %s\n", argv[i]);
+        return 1;
+      }
+      lenv_del(vm->env);
+      vm->env = image;
+    } else if (strcmp(argv[i], "--dump-image") == 0 && has_value) {
+      dump = argv[++i];
+    } else if (strcmp(argv[i], "--serve") == 0 && has_value) {
+      serve = argv[++i];
+    } else if (strcmp(argv[i], "--sandbox") == 0 && has_value) {
+      sandbox = atoi(argv[++i]);
+    } else if ((strcmp(argv[i], "-e") == 0 || strcmp(argv[i], "-l") == 0) && has_value) {
+      nexprs += argv[i][1] == 'e';
+      actions[nactions++] = argv[i];
+      actions[nactions++] = argv[++i];
+    } else if (strcmp(argv[i], "--") == 0) {
+      i++;
+      break;
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      usage(argv[0]);
+      return 2;
+    } else {
+      break;
+    }
+  }
+
+  lenv* e = vm->env;
+
+  // When dumping an image, load each file in turn then save the environment they built
+  if (dump) {
+    for (; i < argc; i++) {
+      lval* x = lval_load(vm, e, argv[i], 0);
+      if (x->type == LVAL_ERR) { lval_println(x); }
+      lval_del(x);
+    }
+    int ok = lenv_image_save(e, dump);
+    if (!ok) { fprintf(stderr, "Could not write image %s\n", dump); }
+    lisp_vm_del(vm);
+    free(actions);
+    return ok ? 0 : 1;
+  }
+
+  // Whatever follows the script, or every argument left after -e, is bound to `args`
+  char* script = nexprs == 0 && i < argc ? argv[i++] : NULL;
+  lval* args = lval_qexpr();
+  for (; i < argc; i++) { lval_add(args, lval_str(argv[i])); }
+  lval* k = lval_sym("args");
+  lenv_put(e, k, args);
+  lval_del(k); lval_del(args);
+
+  // Run without the prompt, stopping at the first error
+  int interactive = script == NULL && nexprs == 0 && serve == NULL;
+  if (!interactive) { setvbuf(stdout, NULL, _IOFBF, 1 << 16); }
+
+  int status = 0;
+  for (int a = 0; a < nactions && !status; a += 2) {
+    if (actions[a][1] == 'l') {
+      status = report(lval_load(vm, e, actions[a+1], 1));
+    } else {
+      status = report(lval_load_str(vm, e, "-e", actions[a+1], 1));
+    }
+  }
+  free(actions);
+
+  if (!interactive) {
+    if (script && !status) {
+      if (strcmp(script, "-") == 0) {
+        status = report(lval_load_stream(vm, e, "<stdin>", stdin, 1));
+      } else {
+        status = report(lval_load(vm, e, script, 1));
+      }
+    }
+    if (serve && !status) {
+      fflush(stdout);
+      status = lisp_serve(vm, serve, sandbox);
+    }
+    fflush(stdout);
+    report_stats(vm);
+    lisp_vm_del(vm);
+    return status;
+  }
+
+  puts("Lisperers Version " LISPERERS_VERSION);
   puts("Press Ctrl+C to Exit\n");
-  
-  lenv* e = lenv_new();
-  lenv_add_builtins(e);
 
   while(1){
 
@@ -63,10 +182,21 @@ int main(int argc, char** argv) {
     char* input = readline("Lisperers> ");
     add_history(input);
 
-    mpc_result_t r;
-      if (mpc_parse("<stdin>", input, Lispy, &r)) {
+    if (!vm->use_mpc) {
+      // Read input from stdin straight into lvals and evaluate it
+      lval* x = lval_read_src("<stdin>", input, strlen(input));
+      if (x->type != LVAL_ERR) { x = lval_eval(vm, e, x); }
+      lval_println(x);
+      lval_del(x);
+    } else {
+      lval* err = vm->Lispy ? NULL : lispy_new(vm);
+      mpc_result_t r;
+      if (err) {
+        lval_println(err);
+        lval_del(err);
+      } else if (mpc_parse("<stdin>", input, vm->Lispy, &r)) {
         // Parse input from stdin and evaluate it
-        lval* x = lval_eval(e, lval_read(r.output));
+        lval* x = lval_eval(vm, e, lval_read(vm, r.output));
         lval_println(x);
         lval_del(x);
         
@@ -77,10 +207,10 @@ int main(int argc, char** argv) {
         mpc_err_print(r.error);
         mpc_err_delete(r.error);
       }
-      // Free dynamically allocated input when done
-      free(input);
     }
-    lenv_del(e);
-    mpc_cleanup(6, Number, Symbol, Sexpr, Qexpr, Expr, Lispy);
-    return 0;
+    // Free dynamically allocated input when done
+    free(input);
+  }
+  lisp_vm_del(vm);
+  return 0;
 }
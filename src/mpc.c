@@ -68,12 +68,94 @@ enum {
 };
 
 enum {
-  MPC_INPUT_MEM_NUM = 512
+  MPC_INPUT_BLOCK = 65536
 };
 
+/*
+** Memory used only while parsing comes from an
+** arena of chunks owned by the input, all freed
+** together once the parse is done. Blocks are a
+** power of two in size, from MPC_ARENA_MIN to
+** MPC_ARENA_MAX, with a header giving the size,
+** and freed blocks are kept on a list for each
+** size to be handed out again.
+*/
+
+enum {
+  MPC_ARENA_CHUNK   = 65536,
+  MPC_ARENA_MIN     = 16,
+  MPC_ARENA_MAX     = 4096,
+  MPC_ARENA_CLASSES = 9
+};
+
+typedef union {
+  size_t size;
+  void *next;
+  double align;
+} mpc_block_t;
+
+typedef struct mpc_chunk_t {
+  struct mpc_chunk_t *next;
+  char *end;
+  mpc_block_t align;
+} mpc_chunk_t;
+
+/*
+** A remembered result of a named parser at some
+** position, used by packrat parsing to give the
+** same result straight away rather than parsing
+** the same input a second time.
+*/
+
+typedef struct {
+  mpc_parser_t *parser;
+  long pos;
+  int success;
+  mpc_val_t *output;
+  mpc_err_t *error;
+  mpc_err_t *merged;
+  mpc_state_t end;
+  char last;
+  int far_ret;
+  long far_pos;
+} mpc_memo_t;
+
+/*
+** The farthest place a parse has failed so far, and
+** what was expected there, kept as the parse runs so
+** a failed parse can give its error without parsing
+** again. A compiled regex gives no errors, so it is
+** kept with where it started instead, to be run as
+** the parser it was compiled from if it is needed.
+**
+** A failed parser also hands its error back to the
+** parser that called it, which is how "one or more
+** of" and counts add their prefix. The item for the
+** error a failure handed back is kept in `ret`, so
+** that a prefix replaces it with a prefixed copy,
+** and `uses` counts how many errors an item stands
+** for, so that it is left out once every one of
+** them has been replaced.
+*/
+
+typedef struct {
+  const char *expected;
+  mpc_parser_t *regex;
+  long start;
+  char *text;
+  char *prefix;
+  int uses;
+} mpc_far_item_t;
+
 typedef struct {
-  char mem[64];
-} mpc_mem_t;
+  mpc_state_t state;
+  char received;
+  const char *failure;
+  int ret;
+  int items_num;
+  int items_slots;
+  mpc_far_item_t *items;
+} mpc_far_t;
 
 typedef struct {
 
@@ -85,6 +167,11 @@ typedef struct {
   char *buffer;
   FILE *file;
 
+  long buffer_pos;
+  size_t buffer_len;
+  size_t buffer_cap;
+  int buffer_eof;
+
   int suppress;
   int backtrack;
   int marks_slots;
@@ -94,9 +181,22 @@ typedef struct {
   char *lasts;
   char last;
 
-  size_t mem_index;
-  char mem_full[MPC_INPUT_MEM_NUM];
-  mpc_mem_t mem[MPC_INPUT_MEM_NUM];
+  mpc_chunk_t *chunks;
+  char *arena_top;
+  char *arena_end;
+  void *arena_free[MPC_ARENA_CLASSES];
+
+  mpc_memo_t *memo;
+  int memo_slots;
+  int memo_num;
+
+  int exact;
+  mpc_far_t far;
+
+  long *lines;
+  int lines_num;
+  int lines_slots;
+  long lines_upto;
 
 } mpc_input_t;
 
@@ -114,6 +214,10 @@ static mpc_input_t *mpc_input_new_string(const char *filename, const char *strin
   strcpy(i->string, string);
   i->buffer = NULL;
   i->file = NULL;
+  i->buffer_pos = 0;
+  i->buffer_len = 0;
+  i->buffer_cap = 0;
+  i->buffer_eof = 0;
 
   i->suppress = 0;
   i->backtrack = 1;
@@ -123,8 +227,27 @@ static mpc_input_t *mpc_input_new_string(const char *filename, const char *strin
   i->lasts = malloc(sizeof(char) * i->marks_slots);
   i->last = '\0';
 
-  i->mem_index = 0;
-  memset(i->mem_full, 0, sizeof(char) * MPC_INPUT_MEM_NUM);
+  i->chunks = NULL;
+  i->arena_top = NULL;
+  i->arena_end = NULL;
+  memset(i->arena_free, 0, sizeof(i->arena_free));
+
+  i->memo = NULL;
+  i->memo_slots = 0;
+  i->memo_num = 0;
+
+  i->exact = 0;
+  i->far.state = mpc_state_invalid();
+  i->far.failure = NULL;
+  i->far.ret = -1;
+  i->far.items_num = 0;
+  i->far.items_slots = 0;
+  i->far.items = NULL;
+
+  i->lines = NULL;
+  i->lines_num = 0;
+  i->lines_slots = 0;
+  i->lines_upto = 0;
 
   return i;
 }
@@ -144,6 +267,10 @@ static mpc_input_t *mpc_input_new_nstring(const char *filename, const char *stri
   i->string[length] = '\0';
   i->buffer = NULL;
   i->file = NULL;
+  i->buffer_pos = 0;
+  i->buffer_len = 0;
+  i->buffer_cap = 0;
+  i->buffer_eof = 0;
 
   i->suppress = 0;
   i->backtrack = 1;
@@ -153,8 +280,27 @@ static mpc_input_t *mpc_input_new_nstring(const char *filename, const char *stri
   i->lasts = malloc(sizeof(char) * i->marks_slots);
   i->last = '\0';
 
-  i->mem_index = 0;
-  memset(i->mem_full, 0, sizeof(char) * MPC_INPUT_MEM_NUM);
+  i->chunks = NULL;
+  i->arena_top = NULL;
+  i->arena_end = NULL;
+  memset(i->arena_free, 0, sizeof(i->arena_free));
+
+  i->memo = NULL;
+  i->memo_slots = 0;
+  i->memo_num = 0;
+
+  i->exact = 0;
+  i->far.state = mpc_state_invalid();
+  i->far.failure = NULL;
+  i->far.ret = -1;
+  i->far.items_num = 0;
+  i->far.items_slots = 0;
+  i->far.items = NULL;
+
+  i->lines = NULL;
+  i->lines_num = 0;
+  i->lines_slots = 0;
+  i->lines_upto = 0;
 
   return i;
 
@@ -173,6 +319,10 @@ static mpc_input_t *mpc_input_new_pipe(const char *filename, FILE *pipe) {
   i->string = NULL;
   i->buffer = NULL;
   i->file = pipe;
+  i->buffer_pos = 0;
+  i->buffer_len = 0;
+  i->buffer_cap = 0;
+  i->buffer_eof = 0;
 
   i->suppress = 0;
   i->backtrack = 1;
@@ -182,8 +332,27 @@ static mpc_input_t *mpc_input_new_pipe(const char *filename, FILE *pipe) {
   i->lasts = malloc(sizeof(char) * i->marks_slots);
   i->last = '\0';
 
-  i->mem_index = 0;
-  memset(i->mem_full, 0, sizeof(char) * MPC_INPUT_MEM_NUM);
+  i->chunks = NULL;
+  i->arena_top = NULL;
+  i->arena_end = NULL;
+  memset(i->arena_free, 0, sizeof(i->arena_free));
+
+  i->memo = NULL;
+  i->memo_slots = 0;
+  i->memo_num = 0;
+
+  i->exact = 0;
+  i->far.state = mpc_state_invalid();
+  i->far.failure = NULL;
+  i->far.ret = -1;
+  i->far.items_num = 0;
+  i->far.items_slots = 0;
+  i->far.items = NULL;
+
+  i->lines = NULL;
+  i->lines_num = 0;
+  i->lines_slots = 0;
+  i->lines_upto = 0;
 
   return i;
 
@@ -201,6 +370,10 @@ static mpc_input_t *mpc_input_new_file(const char *filename, FILE *file) {
   i->string = NULL;
   i->buffer = NULL;
   i->file = file;
+  i->buffer_pos = 0;
+  i->buffer_len = 0;
+  i->buffer_cap = 0;
+  i->buffer_eof = 0;
 
   i->suppress = 0;
   i->backtrack = 1;
@@ -210,48 +383,115 @@ static mpc_input_t *mpc_input_new_file(const char *filename, FILE *file) {
   i->lasts = malloc(sizeof(char) * i->marks_slots);
   i->last = '\0';
 
-  i->mem_index = 0;
-  memset(i->mem_full, 0, sizeof(char) * MPC_INPUT_MEM_NUM);
+  i->chunks = NULL;
+  i->arena_top = NULL;
+  i->arena_end = NULL;
+  memset(i->arena_free, 0, sizeof(i->arena_free));
+
+  i->memo = NULL;
+  i->memo_slots = 0;
+  i->memo_num = 0;
+
+  i->exact = 0;
+  i->far.state = mpc_state_invalid();
+  i->far.failure = NULL;
+  i->far.ret = -1;
+  i->far.items_num = 0;
+  i->far.items_slots = 0;
+  i->far.items = NULL;
+
+  i->lines = NULL;
+  i->lines_num = 0;
+  i->lines_slots = 0;
+  i->lines_upto = 0;
 
   return i;
 }
 
+static void mpc_far_clear(mpc_input_t *i) {
+  int j;
+  for (j = 0; j < i->far.items_num; j++) {
+    free(i->far.items[j].text);
+    free(i->far.items[j].prefix);
+  }
+  i->far.items_num = 0;
+  i->far.failure = NULL;
+  i->far.ret = -1;
+}
+
 static void mpc_input_delete(mpc_input_t *i) {
 
+  mpc_chunk_t *c;
+
   free(i->filename);
 
   if (i->type == MPC_INPUT_STRING) { free(i->string); }
-  if (i->type == MPC_INPUT_PIPE) { free(i->buffer); }
+
+  /* Leave a file positioned just after what was consumed */
+  if (i->type == MPC_INPUT_FILE) {
+    fseek(i->file, i->state.pos - (i->buffer_pos + (long)i->buffer_len), SEEK_CUR);
+  }
+  free(i->buffer);
 
   free(i->marks);
   free(i->lasts);
+  free(i->lines);
+
+  mpc_far_clear(i);
+  free(i->far.items);
+
+  while (i->chunks) {
+    c = i->chunks;
+    i->chunks = c->next;
+    free(c);
+  }
+
   free(i);
 }
 
 static int mpc_mem_ptr(mpc_input_t *i, void *p) {
-  return
-    (char*)p >= (char*)(i->mem) &&
-    (char*)p <  (char*)(i->mem) + (MPC_INPUT_MEM_NUM * sizeof(mpc_mem_t));
+  mpc_chunk_t *c;
+  for (c = i->chunks; c; c = c->next) {
+    if ((char*)p >= (char*)(c + 1) && (char*)p < c->end) { return 1; }
+  }
+  return 0;
+}
+
+static size_t mpc_mem_size(void *p) {
+  return ((mpc_block_t*)p - 1)->size;
 }
 
 static void *mpc_malloc(mpc_input_t *i, size_t n) {
-  size_t j;
-  char *p;
 
-  if (n > sizeof(mpc_mem_t)) { return malloc(n); }
+  int k = 0;
+  size_t size = MPC_ARENA_MIN, chunk;
+  mpc_block_t *b;
+  mpc_chunk_t *c;
 
-  j = i->mem_index;
-  do {
-    if (!i->mem_full[i->mem_index]) {
-      p = (void*)(i->mem + i->mem_index);
-      i->mem_full[i->mem_index] = 1;
-      i->mem_index = (i->mem_index+1) % MPC_INPUT_MEM_NUM;
-      return p;
-    }
-    i->mem_index = (i->mem_index+1) % MPC_INPUT_MEM_NUM;
-  } while (j != i->mem_index);
+  if (n > MPC_ARENA_MAX) { return malloc(n); }
+  while (size < n) { size *= 2; k++; }
+
+  if (i->arena_free[k]) {
+    b = i->arena_free[k];
+    i->arena_free[k] = b->next;
+    return b;
+  }
+
+  /* Each new chunk is twice the size of the last */
+  if ((size_t)(i->arena_end - i->arena_top) < sizeof(mpc_block_t) + size) {
+    chunk = i->chunks ? 2 * (size_t)(i->chunks->end - (char*)(i->chunks + 1)) : MPC_ARENA_CHUNK;
+    c = malloc(sizeof(mpc_chunk_t) + chunk);
+    c->next = i->chunks;
+    c->end = (char*)(c + 1) + chunk;
+    i->chunks = c;
+    i->arena_top = (char*)(c + 1);
+    i->arena_end = c->end;
+  }
 
-  return malloc(n);
+  b = (mpc_block_t*)i->arena_top;
+  b->size = size;
+  i->arena_top += sizeof(mpc_block_t) + size;
+  return b + 1;
 }
 
 static void *mpc_calloc(mpc_input_t *i, size_t n, size_t m) {
@@ -261,10 +501,12 @@ static void *mpc_calloc(mpc_input_t *i, size_t n, size_t m) {
 }
 
 static void mpc_free(mpc_input_t *i, void *p) {
-  size_t j;
+  int k = 0;
+  size_t size;
   if (!mpc_mem_ptr(i, p)) { free(p); return; }
-  j = ((size_t)(((char*)p) - ((char*)i->mem))) / sizeof(mpc_mem_t);
-  i->mem_full[j] = 0;
+  for (size = mpc_mem_size(p); size > MPC_ARENA_MIN; size /= 2) { k++; }
+  ((mpc_block_t*)p)->next = i->arena_free[k];
+  i->arena_free[k] = p;
 }
 
 static void *mpc_realloc(mpc_input_t *i, void *p, size_t n) {
@@ -272,22 +514,19 @@ static void *mpc_realloc(mpc_input_t *i, void *p, size_t n) {
   char *q = NULL;
 
   if (!mpc_mem_ptr(i, p)) { return realloc(p, n); }
+  if (n <= mpc_mem_size(p)) { return p; }
 
-  if (n > sizeof(mpc_mem_t)) {
-    q = malloc(n);
-    memcpy(q, p, sizeof(mpc_mem_t));
-    mpc_free(i, p);
-    return q;
-  }
-
-  return p;
+  q = mpc_malloc(i, n);
+  memcpy(q, p, mpc_mem_size(p));
+  mpc_free(i, p);
+  return q;
 }
 
 static void *mpc_export(mpc_input_t *i, void *p) {
   char *q = NULL;
   if (!mpc_mem_ptr(i, p)) { return p; }
-  q = malloc(sizeof(mpc_mem_t));
-  memcpy(q, p, sizeof(mpc_mem_t));
+  q = malloc(mpc_mem_size(p));
+  memcpy(q, p, mpc_mem_size(p));
   mpc_free(i, p);
   return q;
 }
@@ -313,14 +552,9 @@ static void mpc_input_mark(mpc_input_t *i) {
   i->marks[i->marks_num-1] = i->state;
   i->lasts[i->marks_num-1] = i->last;
 
-  if (i->type == MPC_INPUT_PIPE && i->marks_num == 1) {
-    i->buffer = calloc(1, 1);
-  }
-
 }
 
 static void mpc_input_unmark(mpc_input_t *i) {
-  int j;
 
   if (i->backtrack < 1) { return; }
 
@@ -335,14 +569,6 @@ static void mpc_input_unmark(mpc_input_t *i) {
     i->lasts = realloc(i->lasts, sizeof(char) * i->marks_slots);
   }
 
-  if (i->type == MPC_INPUT_PIPE && i->marks_num == 0) {
-    for (j = strlen(i->buffer) - 1; j >= 0; j--)
-      ungetc(i->buffer[j], i->file);
-
-    free(i->buffer);
-    i->buffer = NULL;
-  }
-
 }
 
 static void mpc_input_rewind(mpc_input_t *i) {
@@ -352,80 +578,211 @@ static void mpc_input_rewind(mpc_input_t *i) {
   i->state = i->marks[i->marks_num-1];
   i->last  = i->lasts[i->marks_num-1];
 
-  if (i->type == MPC_INPUT_FILE) {
-    fseek(i->file, i->state.pos, SEEK_SET);
-  }
-
   mpc_input_unmark(i);
 }
 
-static int mpc_input_buffer_in_range(mpc_input_t *i) {
-  return i->state.pos < (long)(strlen(i->buffer) + i->marks[0].pos);
+/*
+** Only the position is kept up to date while
+** parsing. The row and column are worked out when
+** asked for, from the positions of the newlines
+** before it, which are found as the input is read.
+*/
+
+static void mpc_input_lines(mpc_input_t *i, long pos) {
+
+  long j;
+  char c;
+
+  for (j = i->lines_upto; j < pos; j++) {
+    c = i->type == MPC_INPUT_STRING ? i->string[j] : i->buffer[j - i->buffer_pos];
+    if (c != '\n') { continue; }
+    if (i->lines_num == i->lines_slots) {
+      i->lines_slots = i->lines_slots ? i->lines_slots * 2 : MPC_INPUT_MARKS_MIN;
+      i->lines = realloc(i->lines, sizeof(long) * i->lines_slots);
+    }
+    i->lines[i->lines_num++] = j;
+  }
+
+  if (pos > i->lines_upto) { i->lines_upto = pos; }
 }
 
-static char mpc_input_buffer_get(mpc_input_t *i) {
-  return i->buffer[i->state.pos - i->marks[0].pos];
+static void mpc_input_position(mpc_input_t *i, mpc_state_t *s) {
+
+  int lo = 0, hi, mid;
+
+  mpc_input_lines(i, s->pos);
+
+  hi = i->lines_num;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (i->lines[mid] < s->pos) { lo = mid + 1; } else { hi = mid; }
+  }
+
+  s->row = lo;
+  s->col = lo > 0 ? s->pos - i->lines[lo-1] - 1 : s->pos;
 }
 
-static char mpc_input_getc(mpc_input_t *i) {
+/*
+** Files and pipes are read in blocks into a window
+** starting at the oldest mark, which is the furthest
+** back a parse can rewind, so the window only holds
+** what the parse could still read again.
+*/
 
-  char c = '\0';
+static int mpc_input_buffer_fill(mpc_input_t *i) {
 
-  switch (i->type) {
+  long keep;
+  size_t drop, n;
 
-    case MPC_INPUT_STRING: return i->string[i->state.pos];
-    case MPC_INPUT_FILE: c = fgetc(i->file); return c;
-    case MPC_INPUT_PIPE:
+  while (i->state.pos >= i->buffer_pos + (long)i->buffer_len) {
 
-      if (!i->buffer) { c = getc(i->file); return c; }
+    if (i->buffer_eof) { return 0; }
 
-      if (i->buffer && mpc_input_buffer_in_range(i)) {
-        c = mpc_input_buffer_get(i);
-        return c;
-      } else {
-        c = getc(i->file);
-        return c;
-      }
+    keep = i->marks_num > 0 ? i->marks[0].pos : i->state.pos;
+    drop = (size_t)(keep - i->buffer_pos);
+    if (drop > 0) {
+      mpc_input_lines(i, keep);
+      memmove(i->buffer, i->buffer + drop, i->buffer_len - drop);
+      i->buffer_len -= drop;
+      i->buffer_pos = keep;
+    }
+
+    if (i->buffer_len + MPC_INPUT_BLOCK > i->buffer_cap) {
+      i->buffer_cap = i->buffer_len + MPC_INPUT_BLOCK;
+      i->buffer = realloc(i->buffer, i->buffer_cap);
+    }
 
-    default: return c;
+    n = fread(i->buffer + i->buffer_len, 1, MPC_INPUT_BLOCK, i->file);
+    if (n == 0) { i->buffer_eof = 1; }
+    i->buffer_len += n;
   }
-}
 
-static char mpc_input_peekc(mpc_input_t *i) {
+  return 1;
+}
 
-  char c = '\0';
+static char mpc_input_getc(mpc_input_t *i) {
 
   switch (i->type) {
     case MPC_INPUT_STRING: return i->string[i->state.pos];
     case MPC_INPUT_FILE:
+    case MPC_INPUT_PIPE:
+      if (!mpc_input_buffer_fill(i)) { return '\0'; }
+      return i->buffer[i->state.pos - i->buffer_pos];
+    default: return '\0';
+  }
+}
 
-      c = fgetc(i->file);
-      if (feof(i->file)) { return '\0'; }
+static char mpc_input_peekc(mpc_input_t *i) {
+  return mpc_input_getc(i);
+}
 
-      fseek(i->file, -1, SEEK_CUR);
-      return c;
+/* A character already read, which is still in the window */
+static char mpc_input_at(mpc_input_t *i, long pos) {
+  if (i->type == MPC_INPUT_STRING) { return i->string[pos]; }
+  return pos < i->buffer_pos + (long)i->buffer_len ? i->buffer[pos - i->buffer_pos] : '\0';
+}
 
-    case MPC_INPUT_PIPE:
+/* Whether errors at a position could still be part of the parse's error */
+static int mpc_far_wanted(mpc_input_t *i, long pos) {
+  return !i->suppress && (i->exact || pos >= i->far.state.pos);
+}
 
-      if (!i->buffer) {
-        c = getc(i->file);
-        if (feof(i->file)) { return '\0'; }
-        ungetc(c, i->file);
-        return c;
-      }
+/* Moves the farthest failure on to a position if it is further, returning whether it is there */
+static int mpc_far_reach(mpc_input_t *i, long pos) {
+  if (!mpc_far_wanted(i, pos)) { return 0; }
+  if (pos > i->far.state.pos) {
+    mpc_far_clear(i);
+    i->far.state = i->state;
+    i->far.state.pos = pos;
+    mpc_input_position(i, &i->far.state);
+    i->far.received = mpc_input_at(i, pos);
+  }
+  return 1;
+}
 
-      if (i->buffer && mpc_input_buffer_in_range(i)) {
-        return mpc_input_buffer_get(i);
-      } else {
-        c = getc(i->file);
-        if (feof(i->file)) { return '\0'; }
-        ungetc(c, i->file);
-        return c;
-      }
+static int mpc_far_same_prefix(const char *x, const char *y) {
+  return x == y || (x && y && strcmp(x, y) == 0);
+}
+
+/*
+** Adds what was expected at the farthest failure, or
+** a regex that stopped there, with any prefix it has
+** been given, returning its item. A regex's text is
+** copied from `text` if given, or else the input.
+*/
+static int mpc_far_add(mpc_input_t *i, const char *expected, mpc_parser_t *regex, long start, const char *prefix, const char *text) {
+
+  int j;
+  long n;
+  mpc_far_item_t *it;
+
+  for (j = 0; j < i->far.items_num; j++) {
+    it = &i->far.items[j];
+    if (it->expected == expected && it->regex == regex && it->start == start
+    &&  mpc_far_same_prefix(it->prefix, prefix)) {
+      it->uses++;
+      return j;
+    }
+  }
+
+  if (i->far.items_num == i->far.items_slots) {
+    i->far.items_slots = i->far.items_slots ? i->far.items_slots * 2 : 8;
+    i->far.items = realloc(i->far.items, sizeof(mpc_far_item_t) * i->far.items_slots);
+  }
 
-    default: return c;
+  it = &i->far.items[i->far.items_num++];
+  it->expected = expected;
+  it->regex = regex;
+  it->start = start;
+  it->text = NULL;
+  it->prefix = NULL;
+  it->uses = 1;
+
+  if (prefix) {
+    it->prefix = malloc(strlen(prefix) + 1);
+    strcpy(it->prefix, prefix);
   }
 
+  /* Files and pipes may have dropped the regex's input by the time it is run */
+  if (text) {
+    it->text = malloc(strlen(text) + 1);
+    strcpy(it->text, text);
+  } else if (regex && i->type != MPC_INPUT_STRING) {
+    n = i->far.state.pos - start + 1;
+    it->text = malloc(n + 1);
+    for (j = 0; j < n; j++) { it->text[j] = mpc_input_at(i, start + j); }
+    it->text[n] = '\0';
+  }
+
+  return i->far.items_num - 1;
+}
+
+/*
+** Gives the error a failed parser handed back a
+** prefix, as mpc_err_repeat does, by moving one use
+** of its item over to a copy with the prefix added.
+*/
+static void mpc_far_repeat(mpc_input_t *i, const char *prefix) {
+
+  mpc_far_item_t it;
+  char *p;
+
+  if (i->exact || i->far.ret < 0) { return; }
+
+  it = i->far.items[i->far.ret];
+  i->far.items[i->far.ret].uses--;
+
+  p = malloc(strlen(prefix) + (it.prefix ? strlen(it.prefix) : 0) + 1);
+  strcpy(p, prefix);
+  if (it.prefix) { strcat(p, it.prefix); }
+  i->far.ret = mpc_far_add(i, it.expected, it.regex, it.start, p, it.text);
+  free(p);
+}
+
+static void mpc_far_count(mpc_input_t *i, int n) {
+  char prefix[32];
+  sprintf(prefix, "%i of ", n);
+  mpc_far_repeat(i, prefix);
 }
 
 static int mpc_input_terminated(mpc_input_t *i) {
@@ -433,42 +790,14 @@ static int mpc_input_terminated(mpc_input_t *i) {
 }
 
 static int mpc_input_failure(mpc_input_t *i, char c) {
-
-  switch (i->type) {
-    case MPC_INPUT_STRING: { break; }
-    case MPC_INPUT_FILE: fseek(i->file, -1, SEEK_CUR); { break; }
-    case MPC_INPUT_PIPE: {
-
-      if (!i->buffer) { ungetc(c, i->file); break; }
-
-      if (i->buffer && mpc_input_buffer_in_range(i)) {
-        break;
-      } else {
-        ungetc(c, i->file);
-      }
-    }
-    default: { break; }
-  }
+  (void)i; (void)c;
   return 0;
 }
 
 static int mpc_input_success(mpc_input_t *i, char c, char **o) {
 
-  if (i->type == MPC_INPUT_PIPE
-  &&  i->buffer && !mpc_input_buffer_in_range(i)) {
-    i->buffer = realloc(i->buffer, strlen(i->buffer) + 2);
-    i->buffer[strlen(i->buffer) + 1] = '\0';
-    i->buffer[strlen(i->buffer) + 0] = c;
-  }
-
   i->last = c;
   i->state.pos++;
-  i->state.col++;
-
-  if (c == '\n') {
-    i->state.col = 0;
-    i->state.row++;
-  }
 
   if (o) {
     (*o) = mpc_malloc(i, 2);
@@ -540,6 +869,62 @@ static int mpc_input_string(mpc_input_t *i, const char *c, char **o) {
   return 1;
 }
 
+/*
+** Runs a compiled regex, following its table of
+** states one character at a time until it stops,
+** and succeeding if it stops in an accepting one.
+** It gives no errors of its own, so it is only
+** used while errors are not being built, and if it
+** could have expected more where it stopped it is
+** kept for the farthest failure.
+*/
+
+enum {
+  MPC_DFA_STOP = 0xFF
+};
+
+/* Keeps a regex that failed, or could have gone on, for the farthest failure */
+static void mpc_input_dfa_stop(mpc_input_t *i, mpc_parser_t *p, const unsigned char *next, int ok, long start, long stop) {
+  int c = 0;
+  i->far.ret = -1;
+  if (!mpc_far_wanted(i, stop)) { return; }
+  while (ok && c < 256 && next[c] == MPC_DFA_STOP) { c++; }
+  if (c < 256 && mpc_far_reach(i, stop)) { i->far.ret = mpc_far_add(i, NULL, p, start, NULL, NULL); }
+}
+
+static int mpc_input_dfa(mpc_input_t *i, mpc_parser_t *p, const unsigned char *next, const unsigned char *accept, char **o) {
+
+  int s = 0, t;
+  long n = 0;
+  long start = i->state.pos;
+  const char *x;
+  char c;
+
+  if (i->type == MPC_INPUT_STRING) {
+    x = i->string + start;
+    while ((t = next[s * 256 + (unsigned char)x[n]]) != MPC_DFA_STOP) { s = t; n++; }
+    mpc_input_dfa_stop(i, p, next + s * 256, accept[s], start, start + n);
+    if (!accept[s]) { return 0; }
+    i->state.pos += n;
+    if (n > 0) { i->last = x[n-1]; }
+  } else {
+    mpc_input_mark(i);
+    while ((t = next[s * 256 + (unsigned char)(c = mpc_input_getc(i))]) != MPC_DFA_STOP) {
+      mpc_input_success(i, c, NULL);
+      s = t; n++;
+    }
+    mpc_input_dfa_stop(i, p, next + s * 256, accept[s], start, start + n);
+    if (!accept[s]) { mpc_input_rewind(i); return 0; }
+    x = i->buffer + (start - i->buffer_pos);
+    mpc_input_unmark(i);
+  }
+
+  *o = mpc_malloc(i, n + 1);
+  memcpy(*o, x, n);
+  (*o)[n] = '\0';
+  return 1;
+}
+
 static int mpc_input_anchor(mpc_input_t* i, int(*f)(char,char), char **o) {
   *o = NULL;
   return f(i->last, mpc_input_peekc(i));
@@ -565,6 +950,7 @@ static int mpc_input_eoi(mpc_input_t* i, char **o) {
 static mpc_state_t *mpc_input_state_copy(mpc_input_t *i) {
   mpc_state_t *r = mpc_malloc(i, sizeof(mpc_state_t));
   memcpy(r, &i->state, sizeof(mpc_state_t));
+  mpc_input_position(i, r);
   return r;
 }
 
@@ -601,9 +987,7 @@ static void mpc_err_string_cat(char *buffer, int *pos, int *max, char const *fmt
   va_end(va);
 }
 
-static char char_unescape_buffer[4];
-
-static const char *mpc_err_char_unescape(char c) {
+static const char *mpc_err_char_unescape(char c, char *char_unescape_buffer) {
 
   char_unescape_buffer[0] = '\'';
   char_unescape_buffer[1] = ' ';
@@ -632,6 +1016,7 @@ char *mpc_err_string(mpc_err_t *x) {
   int i;
   int pos = 0;
   int max = 1023;
+  char received[4];
   char *buffer = calloc(1, 1024);
 
   if (x->failure) {
@@ -657,19 +1042,32 @@ char *mpc_err_string(mpc_err_t *x) {
   }
 
   mpc_err_string_cat(buffer, &pos, &max, " at ");
-  mpc_err_string_cat(buffer, &pos, &max, mpc_err_char_unescape(x->received));
+  mpc_err_string_cat(buffer, &pos, &max, mpc_err_char_unescape(x->received, received));
   mpc_err_string_cat(buffer, &pos, &max, "\n");
 
   return realloc(buffer, strlen(buffer) + 1);
 }
 
+/*
+** A parse builds no errors, only keeping the farthest
+** failure, so a successful one never builds any and a
+** failed one builds its error from that. Errors are
+** only built in full when a compiled regex is run as
+** the parser it came from, for the farthest failure.
+*/
+
 static mpc_err_t *mpc_err_new(mpc_input_t *i, const char *expected) {
   mpc_err_t *x;
+  if (!i->exact) {
+    i->far.ret = mpc_far_reach(i, i->state.pos) ? mpc_far_add(i, expected, NULL, 0, NULL, NULL) : -1;
+    return NULL;
+  }
   if (i->suppress) { return NULL; }
   x = mpc_malloc(i, sizeof(mpc_err_t));
   x->filename = mpc_malloc(i, strlen(i->filename) + 1);
   strcpy(x->filename, i->filename);
   x->state = i->state;
+  mpc_input_position(i, &x->state);
   x->expected_num = 1;
   x->expected = mpc_malloc(i, sizeof(char*));
   x->expected[0] = mpc_malloc(i, strlen(expected) + 1);
@@ -681,11 +1079,17 @@ static mpc_err_t *mpc_err_new(mpc_input_t *i, const char *expected) {
 
 static mpc_err_t *mpc_err_fail(mpc_input_t *i, const char *failure) {
   mpc_err_t *x;
+  if (!i->exact) {
+    if (mpc_far_reach(i, i->state.pos) && !i->far.failure) { i->far.failure = failure; }
+    i->far.ret = -1;
+    return NULL;
+  }
   if (i->suppress) { return NULL; }
   x = mpc_malloc(i, sizeof(mpc_err_t));
   x->filename = mpc_malloc(i, strlen(i->filename) + 1);
   strcpy(x->filename, i->filename);
   x->state = i->state;
+  mpc_input_position(i, &x->state);
   x->expected_num = 0;
   x->expected = NULL;
   x->failure = mpc_malloc(i, strlen(failure) + 1);
@@ -862,6 +1266,7 @@ static mpc_err_t *mpc_err_count(mpc_input_t *i, mpc_err_t *x, int n) {
   mpc_err_t *y;
   int digits = n/10 + 1;
   char *prefix;
+  if (x == NULL) { return NULL; }
   prefix = mpc_malloc(i, digits + strlen(" of ") + 1);
   sprintf(prefix, "%i of ", n);
   y = mpc_err_repeat(i, x, prefix);
@@ -876,6 +1281,26 @@ static mpc_err_t *mpc_err_merge(mpc_input_t *i, mpc_err_t *x, mpc_err_t *y) {
   return mpc_err_or(i, errs, 2);
 }
 
+static mpc_err_t *mpc_err_copy(mpc_input_t *i, mpc_err_t *x) {
+  int j;
+  mpc_err_t *y;
+  if (x == NULL) { return NULL; }
+  y = mpc_malloc(i, sizeof(mpc_err_t));
+  *y = *x;
+  y->filename = mpc_malloc(i, strlen(x->filename) + 1);
+  strcpy(y->filename, x->filename);
+  y->expected = x->expected_num ? mpc_malloc(i, sizeof(char*) * x->expected_num) : NULL;
+  for (j = 0; j < x->expected_num; j++) {
+    y->expected[j] = mpc_malloc(i, strlen(x->expected[j]) + 1);
+    strcpy(y->expected[j], x->expected[j]);
+  }
+  if (x->failure) {
+    y->failure = mpc_malloc(i, strlen(x->failure) + 1);
+    strcpy(y->failure, x->failure);
+  }
+  return y;
+}
+
 /*
 ** Parser Type
 */
@@ -914,7 +1339,9 @@ enum {
   MPC_TYPE_CHECK_WITH = 26,
 
   MPC_TYPE_SOI        = 27,
-  MPC_TYPE_EOI        = 28
+  MPC_TYPE_EOI        = 28,
+
+  MPC_TYPE_DFA        = 29
 };
 
 typedef struct { char *m; } mpc_pdata_fail_t;
@@ -932,8 +1359,9 @@ typedef struct { mpc_parser_t *x; mpc_dtor_t dx; mpc_check_with_t f; void *d; ch
 typedef struct { mpc_parser_t *x; } mpc_pdata_predict_t;
 typedef struct { mpc_parser_t *x; mpc_dtor_t dx; mpc_ctor_t lf; } mpc_pdata_not_t;
 typedef struct { int n; mpc_fold_t f; mpc_parser_t *x; mpc_dtor_t dx; } mpc_pdata_repeat_t;
-typedef struct { int n; mpc_parser_t **xs; } mpc_pdata_or_t;
+typedef struct { int n; mpc_parser_t **xs; unsigned char *dispatch; } mpc_pdata_or_t;
 typedef struct { int n; mpc_fold_t f; mpc_parser_t **xs; mpc_dtor_t *dxs;  } mpc_pdata_and_t;
+typedef struct { mpc_parser_t *x; int n; unsigned char *next; unsigned char *accept; } mpc_pdata_dfa_t;
 
 typedef union {
   mpc_pdata_fail_t fail;
@@ -953,6 +1381,7 @@ typedef union {
   mpc_pdata_repeat_t repeat;
   mpc_pdata_and_t and;
   mpc_pdata_or_t or;
+  mpc_pdata_dfa_t dfa;
 } mpc_pdata_t;
 
 struct mpc_parser_t {
@@ -960,6 +1389,9 @@ struct mpc_parser_t {
   mpc_pdata_t data;
   char type;
   char retained;
+  char packrat;
+  char ast;
+  int rule;
 };
 
 static mpc_val_t *mpcf_input_nth_free(mpc_input_t *i, int n, mpc_val_t **xs, int x) {
@@ -1032,288 +1464,634 @@ static void mpc_parse_dtor(mpc_input_t *i, mpc_dtor_t d, mpc_val_t *x) {
   d(mpc_export(i, x));
 }
 
+/*
+** Packrat Parsing
+**
+** The result of every named parser is remembered
+** by position, along with the errors it merged,
+** so alternatives that try the same rule at the
+** same place only parse it once, and parsing takes
+** linear time.
+**
+** Outputs are handed on to folds and applies that
+** take ownership of them, so each is remembered as
+** a copy and handed out as a fresh copy. Only the
+** rules mpca_lang defines are known to output an
+** mpc_ast_t, so only those are remembered.
+**
+** Results are only remembered while backtracking
+** and reporting errors, as those depend only on the
+** parser and the position.
+*/
+
+static mpc_ast_t *mpc_ast_copy(mpc_ast_t *a);
+
+static mpc_memo_t *mpc_memo_find(mpc_input_t *i, mpc_parser_t *p, long pos) {
+  size_t h = ((size_t)p >> 4) * 31 + (size_t)pos;
+  size_t mask = i->memo_slots - 1;
+  mpc_memo_t *m = &i->memo[(h * 2654435761u) & mask];
+  while (m->parser && (m->parser != p || m->pos != pos)) {
+    m = m + 1 == i->memo + i->memo_slots ? i->memo : m + 1;
+  }
+  return m;
+}
+
+static mpc_memo_t *mpc_memo_add(mpc_input_t *i, mpc_parser_t *p, long pos) {
+
+  int j, slots;
+  mpc_memo_t *old, *m;
+
+  if ((i->memo_num + 1) * 2 > i->memo_slots) {
+    old = i->memo;
+    slots = i->memo_slots;
+    i->memo_slots *= 2;
+    i->memo = calloc(i->memo_slots, sizeof(mpc_memo_t));
+    for (j = 0; j < slots; j++) {
+      if (old[j].parser) { *mpc_memo_find(i, old[j].parser, old[j].pos) = old[j]; }
+    }
+    free(old);
+  }
+
+  m = mpc_memo_find(i, p, pos);
+  m->parser = p;
+  m->pos = pos;
+  i->memo_num++;
+  return m;
+}
+
+/* Remembered errors live on the heap, keeping the input's small block pool free */
+static mpc_err_t *mpc_memo_keep(mpc_input_t *i, mpc_err_t *x) {
+  return x ? mpc_err_export(i, mpc_err_copy(i, x)) : NULL;
+}
+
+static void mpc_memo_delete(mpc_input_t *i) {
+  int j;
+  for (j = 0; j < i->memo_slots; j++) {
+    if (i->memo[j].parser == NULL) { continue; }
+    if (i->memo[j].success) {
+      mpc_ast_delete(i->memo[j].output);
+    } else {
+      mpc_err_delete_internal(i, i->memo[j].error);
+    }
+    mpc_err_delete_internal(i, i->memo[j].merged);
+  }
+  free(i->memo);
+  i->memo = NULL;
+}
+
+/*
+** The parser runs on an explicit stack of frames
+** rather than the C stack, so how deeply input can
+** nest is only limited by memory. Starting a parser
+** pushes a frame for it; once it has a result the
+** frame is popped and the result handed back to the
+** frame below, which picks up where it left off.
+*/
+
 enum {
-  MPC_PARSE_STACK_MIN = 4
+  MPC_PARSE_STACK_MIN = 4,
+  MPC_PARSE_FRAMES_MIN = 64
 };
 
-#define MPC_SUCCESS(x) r->output = x; return 1
-#define MPC_FAILURE(x) r->error = x; return 0
-#define MPC_PRIMITIVE(x) \
-  if (x) { MPC_SUCCESS(r->output); } \
-  else { MPC_FAILURE(NULL); }
+enum {
+  MPC_DISPATCH_END = 0xFF
+};
+
+typedef struct {
+  mpc_parser_t *p;
+  int j;
+  int results_slots;
+  mpc_result_t *results;
+  mpc_err_t *e;
+  long pos;
+  int memo;
+  unsigned char *row;
+  mpc_err_t *row_e;
+  int alt;
+} mpc_frame_t;
+
+static void mpc_frame_result(mpc_input_t *i, mpc_frame_t *f, mpc_val_t *x) {
+  if (f->results == NULL) {
+    f->results_slots = MPC_PARSE_STACK_MIN;
+    f->results = mpc_malloc(i, sizeof(mpc_result_t) * f->results_slots);
+  } else if (f->j == f->results_slots) {
+    f->results_slots = f->j + f->j / 2;
+    f->results = mpc_realloc(i, f->results, sizeof(mpc_result_t) * f->results_slots);
+  }
+  f->results[f->j++].output = x;
+}
 
-#define MPC_MAX_RECURSION_DEPTH 1000
+static void mpc_frame_dtor(mpc_input_t *i, mpc_frame_t *f, mpc_dtor_t d) {
+  int k;
+  for (k = 0; k < f->j; k++) { mpc_parse_dtor(i, d, f->results[k].output); }
+}
 
-static int mpc_parse_run(mpc_input_t *i, mpc_parser_t *p, mpc_result_t *r, mpc_err_t **e, int depth) {
+static void mpc_frame_dtors(mpc_input_t *i, mpc_frame_t *f, mpc_dtor_t *ds) {
+  int k;
+  for (k = 0; k < f->j; k++) { mpc_parse_dtor(i, ds[k], f->results[k].output); }
+}
 
-  int j = 0, k = 0;
-  mpc_result_t results_stk[MPC_PARSE_STACK_MIN];
-  mpc_result_t *results;
-  int results_slots = MPC_PARSE_STACK_MIN;
+/* Merges the errors of alternatives in a dispatch row, from the `k`th up to the `n`th */
+static mpc_err_t *mpc_frame_row_errs(mpc_input_t *i, mpc_frame_t *f, mpc_err_t *e, int k, int n) {
+  for (; k < n && f->row[k] != MPC_DISPATCH_END; k++) {
+    e = mpc_err_merge(i, e, f->results[f->row[k]].error);
+  }
+  return e;
+}
 
-  if (depth == MPC_MAX_RECURSION_DEPTH)
-  {
-    MPC_FAILURE(mpc_err_fail(i, "Maximum recursion depth exceeded!"));
+#define MPC_CALL(x) q = x; goto call
+#define MPC_SUCCESS(x) res.output = x; ok = 1; goto finish
+#define MPC_FAILURE(x) res.error = x; ok = 0; goto finish
+#define MPC_PRIMITIVE(x) \
+  if (x) { MPC_SUCCESS(res.output); } \
+  else { i->far.ret = -1; MPC_FAILURE(NULL); }
+
+static int mpc_parse_run(mpc_input_t *i, mpc_parser_t *p, mpc_result_t *r, mpc_err_t **e) {
+
+  int ok = 0;
+  mpc_result_t res;
+  mpc_parser_t *q = p;
+  mpc_frame_t *f;
+  mpc_memo_t *m;
+  mpc_err_t *merged;
+
+  int frames_num = 0;
+  int frames_slots = MPC_PARSE_FRAMES_MIN;
+  mpc_frame_t *frames = malloc(sizeof(mpc_frame_t) * frames_slots);
+
+  res.output = NULL;
+
+call:
+
+  /* A parser already tried here gives its remembered result */
+  if (i->memo && q->ast && !i->suppress && i->backtrack > 0) {
+    m = mpc_memo_find(i, q, i->state.pos);
+    if (m->parser) {
+      if (m->merged) { *e = mpc_err_merge(i, *e, mpc_err_copy(i, m->merged)); }
+      i->state = m->end;
+      i->last = m->last;
+      ok = m->success;
+      if (ok) { res.output = mpc_ast_copy(m->output); }
+      else    { res.error = mpc_err_copy(i, m->error); }
+      if (!ok && !i->exact) {
+        i->far.ret = m->far_pos == i->far.state.pos ? m->far_ret : -1;
+        if (i->far.ret >= 0) { i->far.items[i->far.ret].uses++; }
+      }
+      goto resume;
+    }
   }
 
-  switch (p->type) {
+  if (frames_num == frames_slots) {
+    frames_slots *= 2;
+    frames = realloc(frames, sizeof(mpc_frame_t) * frames_slots);
+  }
+
+  f = &frames[frames_num++];
+  f->p = q;
+  f->j = 0;
+  f->results = NULL;
+  f->pos = i->state.pos;
+  f->row = NULL;
+  f->memo = i->memo && q->ast && !i->suppress && i->backtrack > 0;
+
+  /* Errors merged inside a remembered parser are gathered separately */
+  if (f->memo) {
+    f->e = *e;
+    *e = NULL;
+  }
+
+  switch (q->type) {
 
     /* Basic Parsers */
 
-    case MPC_TYPE_ANY:     MPC_PRIMITIVE(mpc_input_any(i, (char**)&r->output));
-    case MPC_TYPE_SINGLE:  MPC_PRIMITIVE(mpc_input_char(i, p->data.single.x, (char**)&r->output));
-    case MPC_TYPE_RANGE:   MPC_PRIMITIVE(mpc_input_range(i, p->data.range.x, p->data.range.y, (char**)&r->output));
-    case MPC_TYPE_ONEOF:   MPC_PRIMITIVE(mpc_input_oneof(i, p->data.string.x, (char**)&r->output));
-    case MPC_TYPE_NONEOF:  MPC_PRIMITIVE(mpc_input_noneof(i, p->data.string.x, (char**)&r->output));
-    case MPC_TYPE_SATISFY: MPC_PRIMITIVE(mpc_input_satisfy(i, p->data.satisfy.f, (char**)&r->output));
-    case MPC_TYPE_STRING:  MPC_PRIMITIVE(mpc_input_string(i, p->data.string.x, (char**)&r->output));
-    case MPC_TYPE_ANCHOR:  MPC_PRIMITIVE(mpc_input_anchor(i, p->data.anchor.f, (char**)&r->output));
-    case MPC_TYPE_SOI:     MPC_PRIMITIVE(mpc_input_soi(i, (char**)&r->output));
-    case MPC_TYPE_EOI:     MPC_PRIMITIVE(mpc_input_eoi(i, (char**)&r->output));
+    case MPC_TYPE_ANY:     MPC_PRIMITIVE(mpc_input_any(i, (char**)&res.output));
+    case MPC_TYPE_SINGLE:  MPC_PRIMITIVE(mpc_input_char(i, q->data.single.x, (char**)&res.output));
+    case MPC_TYPE_RANGE:   MPC_PRIMITIVE(mpc_input_range(i, q->data.range.x, q->data.range.y, (char**)&res.output));
+    case MPC_TYPE_ONEOF:   MPC_PRIMITIVE(mpc_input_oneof(i, q->data.string.x, (char**)&res.output));
+    case MPC_TYPE_NONEOF:  MPC_PRIMITIVE(mpc_input_noneof(i, q->data.string.x, (char**)&res.output));
+    case MPC_TYPE_SATISFY: MPC_PRIMITIVE(mpc_input_satisfy(i, q->data.satisfy.f, (char**)&res.output));
+    case MPC_TYPE_STRING:  MPC_PRIMITIVE(mpc_input_string(i, q->data.string.x, (char**)&res.output));
+    case MPC_TYPE_ANCHOR:  MPC_PRIMITIVE(mpc_input_anchor(i, q->data.anchor.f, (char**)&res.output));
+    case MPC_TYPE_SOI:     MPC_PRIMITIVE(mpc_input_soi(i, (char**)&res.output));
+    case MPC_TYPE_EOI:     MPC_PRIMITIVE(mpc_input_eoi(i, (char**)&res.output));
+
+    /* Compiled Regexes */
+
+    case MPC_TYPE_DFA:
+      if (i->exact || i->backtrack < 1) { MPC_CALL(q->data.dfa.x); }
+      if (mpc_input_dfa(i, q, q->data.dfa.next, q->data.dfa.accept, (char**)&res.output)) {
+        MPC_SUCCESS(res.output);
+      }
+      MPC_FAILURE(NULL);
 
     /* Other parsers */
 
     case MPC_TYPE_UNDEFINED: MPC_FAILURE(mpc_err_fail(i, "Parser Undefined!"));
     case MPC_TYPE_PASS:      MPC_SUCCESS(NULL);
-    case MPC_TYPE_FAIL:      MPC_FAILURE(mpc_err_fail(i, p->data.fail.m));
-    case MPC_TYPE_LIFT:      MPC_SUCCESS(p->data.lift.lf());
-    case MPC_TYPE_LIFT_VAL:  MPC_SUCCESS(p->data.lift.x);
+    case MPC_TYPE_FAIL:      MPC_FAILURE(mpc_err_fail(i, q->data.fail.m));
+    case MPC_TYPE_LIFT:      MPC_SUCCESS(q->data.lift.lf());
+    case MPC_TYPE_LIFT_VAL:  MPC_SUCCESS(q->data.lift.x);
     case MPC_TYPE_STATE:     MPC_SUCCESS(mpc_input_state_copy(i));
 
     /* Application Parsers */
 
-    case MPC_TYPE_APPLY:
-      if (mpc_parse_run(i, p->data.apply.x, r, e, depth+1)) {
-        MPC_SUCCESS(mpc_parse_apply(i, p->data.apply.f, r->output));
-      } else {
-        MPC_FAILURE(r->output);
-      }
+    case MPC_TYPE_APPLY:      MPC_CALL(q->data.apply.x);
+    case MPC_TYPE_APPLY_TO:   MPC_CALL(q->data.apply_to.x);
+    case MPC_TYPE_CHECK:      MPC_CALL(q->data.check.x);
+    case MPC_TYPE_CHECK_WITH: MPC_CALL(q->data.check_with.x);
 
-    case MPC_TYPE_APPLY_TO:
-      if (mpc_parse_run(i, p->data.apply_to.x, r, e, depth+1)) {
-        MPC_SUCCESS(mpc_parse_apply_to(i, p->data.apply_to.f, r->output, p->data.apply_to.d));
-      } else {
-        MPC_FAILURE(r->error);
-      }
+    case MPC_TYPE_EXPECT:
+      mpc_input_suppress_enable(i);
+      MPC_CALL(q->data.expect.x);
 
-    case MPC_TYPE_CHECK:
-      if (mpc_parse_run(i, p->data.check.x, r, e, depth+1)) {
-        if (p->data.check.f(&r->output)) {
-          MPC_SUCCESS(r->output);
-        } else {
-          mpc_parse_dtor(i, p->data.check.dx, r->output);
-          MPC_FAILURE(mpc_err_fail(i, p->data.check.e));
-        }
-      } else {
-        MPC_FAILURE(r->error);
-      }
+    case MPC_TYPE_PREDICT:
+      mpc_input_backtrack_disable(i);
+      MPC_CALL(q->data.predict.x);
 
-    case MPC_TYPE_CHECK_WITH:
-      if (mpc_parse_run(i, p->data.check_with.x, r, e, depth+1)) {
-        if (p->data.check_with.f(&r->output, p->data.check_with.d)) {
-          MPC_SUCCESS(r->output);
-        } else {
-          mpc_parse_dtor(i, p->data.check.dx, r->output);
-          MPC_FAILURE(mpc_err_fail(i, p->data.check_with.e));
+    /* Optional Parsers */
+
+    case MPC_TYPE_NOT:
+      mpc_input_mark(i);
+      mpc_input_suppress_enable(i);
+      MPC_CALL(q->data.not.x);
+
+    case MPC_TYPE_MAYBE:
+      MPC_CALL(q->data.not.x);
+
+    /* Repeat Parsers */
+
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      MPC_CALL(q->data.repeat.x);
+
+    /* Combinatory Parsers */
+
+    case MPC_TYPE_OR:
+      if (q->data.or.n == 0) { MPC_SUCCESS(NULL); }
+
+      /* Only alternatives that can start with the next character are tried */
+      if (q->data.or.dispatch && i->backtrack > 0) {
+        f->row = q->data.or.dispatch + (unsigned char)mpc_input_peekc(i) * (q->data.or.n + 1);
+        if (f->row[0] != MPC_DISPATCH_END) {
+          mpc_input_mark(i);
+          f->row_e = *e;
+          f->alt = -1;
+          f->results = mpc_malloc(i, sizeof(mpc_result_t) * q->data.or.n);
+          *e = NULL;
+          MPC_CALL(q->data.or.xs[f->row[0]]);
         }
-      } else {
-        MPC_FAILURE(r->error);
+        f->row = NULL;
       }
 
+      MPC_CALL(q->data.or.xs[0]);
+
+    case MPC_TYPE_AND:
+      if (q->data.and.n == 0) { MPC_SUCCESS(NULL); }
+      mpc_input_mark(i);
+      MPC_CALL(q->data.and.xs[0]);
+
+    /* End */
+
+    default:
+      MPC_FAILURE(mpc_err_fail(i, "Unknown Parser Type Id!"));
+  }
+
+finish:
+
+  /* The top frame has its result, so is popped, remembering the result if needed */
+  f = &frames[--frames_num];
+  if (f->results) { mpc_free(i, f->results); }
+
+  if (f->memo) {
+    merged = *e;
+    *e = f->e;
+    m = mpc_memo_add(i, f->p, f->pos);
+    m->success = ok;
+    if (ok) { m->output = mpc_ast_copy(res.output); }
+    else    { m->error = mpc_memo_keep(i, res.error); }
+    m->merged = mpc_memo_keep(i, merged);
+    m->end = i->state;
+    m->last = i->last;
+    m->far_ret = ok ? -1 : i->far.ret;
+    m->far_pos = i->far.state.pos;
+    if (merged) { *e = mpc_err_merge(i, *e, merged); }
+  }
+
+resume:
+
+  /* The result goes back to the frame below, or out once the stack is empty */
+  if (frames_num == 0) {
+    free(frames);
+    *r = res;
+    return ok;
+  }
+
+  f = &frames[frames_num-1];
+  q = f->p;
+
+  switch (q->type) {
+
+    /* Application Parsers */
+
+    case MPC_TYPE_APPLY:
+      if (ok) { MPC_SUCCESS(mpc_parse_apply(i, q->data.apply.f, res.output)); }
+      else    { MPC_FAILURE(res.error); }
+
+    case MPC_TYPE_APPLY_TO:
+      if (ok) { MPC_SUCCESS(mpc_parse_apply_to(i, q->data.apply_to.f, res.output, q->data.apply_to.d)); }
+      else    { MPC_FAILURE(res.error); }
+
+    case MPC_TYPE_CHECK:
+      if (!ok) { MPC_FAILURE(res.error); }
+      if (q->data.check.f(&res.output)) { MPC_SUCCESS(res.output); }
+      mpc_parse_dtor(i, q->data.check.dx, res.output);
+      MPC_FAILURE(mpc_err_fail(i, q->data.check.e));
+
+    case MPC_TYPE_CHECK_WITH:
+      if (!ok) { MPC_FAILURE(res.error); }
+      if (q->data.check_with.f(&res.output, q->data.check_with.d)) { MPC_SUCCESS(res.output); }
+      mpc_parse_dtor(i, q->data.check_with.dx, res.output);
+      MPC_FAILURE(mpc_err_fail(i, q->data.check_with.e));
+
     case MPC_TYPE_EXPECT:
-      mpc_input_suppress_enable(i);
-      if (mpc_parse_run(i, p->data.expect.x, r, e, depth+1)) {
-        mpc_input_suppress_disable(i);
-        MPC_SUCCESS(r->output);
-      } else {
-        mpc_input_suppress_disable(i);
-        MPC_FAILURE(mpc_err_new(i, p->data.expect.m));
-      }
+      mpc_input_suppress_disable(i);
+      if (ok) { MPC_SUCCESS(res.output); }
+      else    { MPC_FAILURE(mpc_err_new(i, q->data.expect.m)); }
 
     case MPC_TYPE_PREDICT:
-      mpc_input_backtrack_disable(i);
-      if (mpc_parse_run(i, p->data.predict.x, r, e, depth+1)) {
-        mpc_input_backtrack_enable(i);
-        MPC_SUCCESS(r->output);
-      } else {
-        mpc_input_backtrack_enable(i);
-        MPC_FAILURE(r->error);
-      }
+      mpc_input_backtrack_enable(i);
+      if (ok) { MPC_SUCCESS(res.output); }
+      else    { MPC_FAILURE(res.error); }
+
+    case MPC_TYPE_DFA:
+      if (ok) { MPC_SUCCESS(res.output); }
+      else    { MPC_FAILURE(res.error); }
 
     /* Optional Parsers */
 
     /* TODO: Update Not Error Message */
 
     case MPC_TYPE_NOT:
-      mpc_input_mark(i);
-      mpc_input_suppress_enable(i);
-      if (mpc_parse_run(i, p->data.not.x, r, e, depth+1)) {
+      if (ok) {
         mpc_input_rewind(i);
         mpc_input_suppress_disable(i);
-        mpc_parse_dtor(i, p->data.not.dx, r->output);
+        mpc_parse_dtor(i, q->data.not.dx, res.output);
         MPC_FAILURE(mpc_err_new(i, "opposite"));
       } else {
         mpc_input_unmark(i);
         mpc_input_suppress_disable(i);
-        MPC_SUCCESS(p->data.not.lf());
+        MPC_SUCCESS(q->data.not.lf());
       }
 
     case MPC_TYPE_MAYBE:
-      if (mpc_parse_run(i, p->data.not.x, r, e, depth+1)) {
-        MPC_SUCCESS(r->output);
-      } else {
-        *e = mpc_err_merge(i, *e, r->error);
-        MPC_SUCCESS(p->data.not.lf());
-      }
+      if (ok) { MPC_SUCCESS(res.output); }
+      *e = mpc_err_merge(i, *e, res.error);
+      MPC_SUCCESS(q->data.not.lf());
 
     /* Repeat Parsers */
 
     case MPC_TYPE_MANY:
-
-      results = results_stk;
-
-      while (mpc_parse_run(i, p->data.repeat.x, &results[j], e, depth+1)) {
-        j++;
-        if (j == MPC_PARSE_STACK_MIN) {
-          results_slots = j + j / 2;
-          results = mpc_malloc(i, sizeof(mpc_result_t) * results_slots);
-          memcpy(results, results_stk, sizeof(mpc_result_t) * MPC_PARSE_STACK_MIN);
-        } else if (j >= results_slots) {
-          results_slots = j + j / 2;
-          results = mpc_realloc(i, results, sizeof(mpc_result_t) * results_slots);
-        }
+      if (ok) {
+        mpc_frame_result(i, f, res.output);
+        MPC_CALL(q->data.repeat.x);
       }
-
-      *e = mpc_err_merge(i, *e, results[j].error);
-
-      MPC_SUCCESS(
-        mpc_parse_fold(i, p->data.repeat.f, j, (mpc_val_t**)results);
-        if (j >= MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
+      *e = mpc_err_merge(i, *e, res.error);
+      MPC_SUCCESS(mpc_parse_fold(i, q->data.repeat.f, f->j, (mpc_val_t**)f->results));
 
     case MPC_TYPE_MANY1:
+      if (ok) {
+        mpc_frame_result(i, f, res.output);
+        MPC_CALL(q->data.repeat.x);
+      }
+      if (f->j == 0) {
+        mpc_far_repeat(i, "one or more of ");
+        MPC_FAILURE(mpc_err_many1(i, res.error));
+      }
+      *e = mpc_err_merge(i, *e, res.error);
+      MPC_SUCCESS(mpc_parse_fold(i, q->data.repeat.f, f->j, (mpc_val_t**)f->results));
 
-      results = results_stk;
-
-      while (mpc_parse_run(i, p->data.repeat.x, &results[j], e, depth+1)) {
-        j++;
-        if (j == MPC_PARSE_STACK_MIN) {
-          results_slots = j + j / 2;
-          results = mpc_malloc(i, sizeof(mpc_result_t) * results_slots);
-          memcpy(results, results_stk, sizeof(mpc_result_t) * MPC_PARSE_STACK_MIN);
-        } else if (j >= results_slots) {
-          results_slots = j + j / 2;
-          results = mpc_realloc(i, results, sizeof(mpc_result_t) * results_slots);
-        }
+    case MPC_TYPE_COUNT:
+      if (ok) {
+        mpc_frame_result(i, f, res.output);
+        if (f->j < q->data.repeat.n) { MPC_CALL(q->data.repeat.x); }
+        MPC_SUCCESS(mpc_parse_fold(i, q->data.repeat.f, f->j, (mpc_val_t**)f->results));
       }
+      mpc_frame_dtor(i, f, q->data.repeat.dx);
+      mpc_far_count(i, q->data.repeat.n);
+      MPC_FAILURE(mpc_err_count(i, res.error, q->data.repeat.n));
 
-      if (j == 0) {
-        MPC_FAILURE(
-          mpc_err_many1(i, results[j].error);
-          if (j >= MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
-      } else {
+    /* Combinatory Parsers */
 
-        *e = mpc_err_merge(i, *e, results[j].error);
+    case MPC_TYPE_OR:
 
-        MPC_SUCCESS(
-          mpc_parse_fold(i, p->data.repeat.f, j, (mpc_val_t**)results);
-          if (j >= MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
+      /*
+      ** Alternatives that were skipped could only have
+      ** failed here, so once one that was tried has
+      ** consumed input their errors would be dropped
+      ** anyway. If none succeed, the skipped ones are
+      ** tried in their place among the errors kept from
+      ** those that were, giving the usual errors without
+      ** parsing anything twice. Only if one fails after
+      ** consuming input, with backtracking turned off
+      ** inside it, is every alternative tried again.
+      */
+
+      if (f->row && f->alt < 0) {
+        if (ok) {
+          mpc_input_unmark(i);
+          merged = *e;
+          *e = mpc_frame_row_errs(i, f, f->row_e, 0, f->j);
+          if (merged) { *e = mpc_err_merge(i, *e, merged); }
+          MPC_SUCCESS(res.output);
+        }
+        f->results[f->row[f->j++]].error = mpc_err_merge(i, *e, res.error);
+        *e = NULL;
+        if (i->state.pos == f->pos && f->row[f->j] != MPC_DISPATCH_END) {
+          MPC_CALL(q->data.or.xs[f->row[f->j]]);
+        }
+        if (i->state.pos != f->pos) {
+          mpc_err_delete_internal(i, mpc_frame_row_errs(i, f, NULL, 0, f->j));
+          *e = f->row_e;
+          mpc_input_rewind(i);
+          f->row = NULL;
+          f->j = 0;
+          MPC_CALL(q->data.or.xs[0]);
+        }
+        mpc_input_rewind(i);
+        *e = f->row_e;
+        f->alt = 0;
+        f->j = 0;
+        goto or_next;
       }
 
-    case MPC_TYPE_COUNT:
+      if (f->row) {
+        if (ok) {
+          mpc_err_delete_internal(i, mpc_frame_row_errs(i, f, NULL, f->j, q->data.or.n));
+          MPC_SUCCESS(res.output);
+        }
+        *e = mpc_err_merge(i, *e, res.error);
+      or_next:
+        for (; f->alt < q->data.or.n; f->alt++) {
+          if (f->row[f->j] != f->alt) {
+            if (mpc_far_wanted(i, f->pos)) { MPC_CALL(q->data.or.xs[f->alt++]); }
+            continue;
+          }
+          *e = mpc_frame_row_errs(i, f, *e, f->j, f->j + 1);
+          f->j++;
+        }
+        i->far.ret = -1;
+        MPC_FAILURE(NULL);
+      }
 
-      results = p->data.repeat.n > MPC_PARSE_STACK_MIN
-        ? mpc_malloc(i, sizeof(mpc_result_t) * p->data.repeat.n)
-        : results_stk;
+      if (ok) { MPC_SUCCESS(res.output); }
+      *e = mpc_err_merge(i, *e, res.error);
+      if (++f->j < q->data.or.n) { MPC_CALL(q->data.or.xs[f->j]); }
+      i->far.ret = -1;
+      MPC_FAILURE(NULL);
 
-      while (mpc_parse_run(i, p->data.repeat.x, &results[j], e, depth+1)) {
-        j++;
-        if (j == p->data.repeat.n) { break; }
+    case MPC_TYPE_AND:
+      if (ok) {
+        mpc_frame_result(i, f, res.output);
+        if (f->j < q->data.and.n) { MPC_CALL(q->data.and.xs[f->j]); }
+        mpc_input_unmark(i);
+        MPC_SUCCESS(mpc_parse_fold(i, q->data.and.f, f->j, (mpc_val_t**)f->results));
       }
+      mpc_input_rewind(i);
+      mpc_frame_dtors(i, f, q->data.and.dxs);
+      MPC_FAILURE(res.error);
 
-      if (j == p->data.repeat.n) {
-        MPC_SUCCESS(
-          mpc_parse_fold(i, p->data.repeat.f, j, (mpc_val_t**)results);
-          if (p->data.repeat.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
-      } else {
-        for (k = 0; k < j; k++) {
-          mpc_parse_dtor(i, p->data.repeat.dx, results[k].output);
-        }
-        MPC_FAILURE(
-          mpc_err_count(i, results[j].error, p->data.repeat.n);
-          if (p->data.repeat.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
-      }
+    default:
+      MPC_FAILURE(mpc_err_fail(i, "Unknown Parser Type Id!"));
+  }
 
-    /* Combinatory Parsers */
+}
 
-    case MPC_TYPE_OR:
+#undef MPC_CALL
+#undef MPC_SUCCESS
+#undef MPC_FAILURE
+#undef MPC_PRIMITIVE
 
-      if (p->data.or.n == 0) { MPC_SUCCESS(NULL); }
+static int mpc_parse_start(mpc_input_t *i, mpc_parser_t *p, mpc_result_t *r, mpc_err_t **e) {
+  int x;
+  *e = i->exact ? mpc_err_fail(i, "Unknown Error") : NULL;
+  if (*e) { (*e)->state = mpc_state_invalid(); }
+  if (p->packrat) {
+    i->memo_slots = 256;
+    i->memo = calloc(i->memo_slots, sizeof(mpc_memo_t));
+  }
+  x = mpc_parse_run(i, p, r, e);
+  if (i->memo) { mpc_memo_delete(i); }
+  return x;
+}
 
-      results = p->data.or.n > MPC_PARSE_STACK_MIN
-        ? mpc_malloc(i, sizeof(mpc_result_t) * p->data.or.n)
-        : results_stk;
+/* Adds what was expected to an error, with any prefix it was given */
+static void mpc_far_expected(mpc_input_t *i, mpc_err_t *x, const char *prefix, const char *expected) {
+  char *full = (char*)expected;
+  if (prefix) {
+    full = mpc_malloc(i, strlen(prefix) + strlen(expected) + 1);
+    strcpy(full, prefix);
+    strcat(full, expected);
+  }
+  if (!mpc_err_contains_expected(i, x, full)) { mpc_err_add_expected(i, x, full); }
+  if (prefix) { mpc_free(i, full); }
+}
 
-      for (j = 0; j < p->data.or.n; j++) {
-        if (mpc_parse_run(i, p->data.or.xs[j], &results[j], e, depth+1)) {
-          MPC_SUCCESS(results[j].output;
-            if (p->data.or.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
-        } else {
-          *e = mpc_err_merge(i, *e, results[j].error);
-        }
-      }
+/*
+** Adds the errors a regex kept by the farthest
+** failure gives there. Those it merged along the way
+** come with the item it was first kept as, and the
+** one it hands back comes with every item still in
+** use, given that item's prefix.
+*/
+static void mpc_far_regex(mpc_input_t *i, mpc_err_t *x, mpc_far_item_t *it) {
 
-      MPC_FAILURE(NULL;
-        if (p->data.or.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
+  int j;
+  long n = i->far.state.pos - it->start;
+  const char *text = it->text ? it->text : i->string + it->start;
+  mpc_input_t *s = mpc_input_new_nstring(i->filename, text, n + (text[n] != '\0'));
+  mpc_result_t r;
+  mpc_err_t *e;
 
-    case MPC_TYPE_AND:
+  /* A regex outputs the string it matched */
+  s->exact = 1;
+  r.error = NULL;
+  if (mpc_parse_start(s, it->regex->data.dfa.x, &r, &e)) { mpc_free(s, r.output); r.error = NULL; }
+  if (it->prefix) {
+    mpc_err_delete_internal(s, e);
+    e = NULL;
+    r.error = mpc_err_repeat(s, r.error, it->prefix);
+  }
+  if (it->uses > 0) {
+    e = mpc_err_merge(s, e, r.error);
+  } else {
+    mpc_err_delete_internal(s, r.error);
+  }
 
-      if (p->data.and.n == 0) { MPC_SUCCESS(NULL); }
+  if (e && e->state.pos == n) {
+    if (e->failure && !x->failure) {
+      x->failure = mpc_malloc(i, strlen(e->failure) + 1);
+      strcpy(x->failure, e->failure);
+    }
+    for (j = 0; j < e->expected_num; j++) {
+      if (!mpc_err_contains_expected(i, x, e->expected[j])) { mpc_err_add_expected(i, x, e->expected[j]); }
+    }
+  }
 
-      results = p->data.or.n > MPC_PARSE_STACK_MIN
-        ? mpc_malloc(i, sizeof(mpc_result_t) * p->data.or.n)
-        : results_stk;
+  mpc_err_delete_internal(s, e);
+  mpc_input_delete(s);
+}
 
-      mpc_input_mark(i);
-      for (j = 0; j < p->data.and.n; j++) {
-        if (!mpc_parse_run(i, p->data.and.xs[j], &results[j], e, depth+1)) {
-          mpc_input_rewind(i);
-          for (k = 0; k < j; k++) {
-            mpc_parse_dtor(i, p->data.and.dxs[k], results[k].output);
-          }
-          MPC_FAILURE(results[j].error;
-            if (p->data.or.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
-        }
-      }
-      mpc_input_unmark(i);
-      MPC_SUCCESS(
-        mpc_parse_fold(i, p->data.and.f, j, (mpc_val_t**)results);
-        if (p->data.or.n > MPC_PARSE_STACK_MIN) { mpc_free(i, results); });
+/* Builds the error for a failed parse from its farthest failure */
+static mpc_err_t *mpc_far_error(mpc_input_t *i) {
 
-    /* End */
+  int j;
+  mpc_far_item_t *it;
+  mpc_err_t *x = mpc_malloc(i, sizeof(mpc_err_t));
 
-    default:
+  x->filename = mpc_malloc(i, strlen(i->filename) + 1);
+  strcpy(x->filename, i->filename);
+  x->state = i->far.state;
+  x->expected_num = 0;
+  x->expected = NULL;
+  x->failure = NULL;
+  x->received = i->far.received;
 
-      MPC_FAILURE(mpc_err_fail(i, "Unknown Parser Type Id!"));
+  if (i->far.failure) {
+    x->failure = mpc_malloc(i, strlen(i->far.failure) + 1);
+    strcpy(x->failure, i->far.failure);
   }
 
-  return 0;
+  for (j = 0; j < i->far.items_num; j++) {
+    it = &i->far.items[j];
+    if (it->regex) {
+      mpc_far_regex(i, x, it);
+    } else if (it->uses > 0) {
+      mpc_far_expected(i, x, it->prefix, it->expected);
+    }
+  }
 
-}
+  if (!x->failure && x->expected_num == 0) {
+    x->failure = mpc_malloc(i, strlen("Unknown Error") + 1);
+    strcpy(x->failure, "Unknown Error");
+    x->state = mpc_state_invalid();
+  }
 
-#undef MPC_SUCCESS
-#undef MPC_FAILURE
-#undef MPC_PRIMITIVE
+  return x;
+}
 
 int mpc_parse_input(mpc_input_t *i, mpc_parser_t *p, mpc_result_t *r) {
   int x;
-  mpc_err_t *e = mpc_err_fail(i, "Unknown Error");
-  e->state = mpc_state_invalid();
-  x = mpc_parse_run(i, p, r, &e, 0);
+  mpc_err_t *e;
+
+  x = mpc_parse_start(i, p, r, &e);
+  mpc_err_delete_internal(i, e);
+
   if (x) {
-    mpc_err_delete_internal(i, e);
     r->output = mpc_export(i, r->output);
   } else {
-    r->error = mpc_err_export(i, mpc_err_merge(i, e, r->error));
+    mpc_err_delete_internal(i, r->error);
+    r->error = mpc_err_export(i, mpc_far_error(i));
   }
   return x;
 }
@@ -1379,6 +2157,7 @@ static void mpc_undefine_or(mpc_parser_t *p) {
     mpc_undefine_unretained(p->data.or.xs[i], 0);
   }
   free(p->data.or.xs);
+  free(p->data.or.dispatch);
 
 }
 
@@ -1440,6 +2219,12 @@ static void mpc_undefine_unretained(mpc_parser_t *p, int force) {
       free(p->data.check_with.e);
       break;
 
+    case MPC_TYPE_DFA:
+      mpc_undefine_unretained(p->data.dfa.x, 0);
+      free(p->data.dfa.next);
+      free(p->data.dfa.accept);
+      break;
+
     default: break;
   }
 
@@ -1474,9 +2259,20 @@ static mpc_parser_t *mpc_undefined(void) {
   p->retained = 0;
   p->type = MPC_TYPE_UNDEFINED;
   p->name = NULL;
+  p->rule = -1;
   return p;
 }
 
+int mpc_packrat(mpc_parser_t *p, int enable) {
+  if (enable && !p->ast) { return 0; }
+  p->packrat = enable;
+  return 1;
+}
+
+int mpc_rule_id(mpc_parser_t *p) {
+  return p->rule;
+}
+
 mpc_parser_t *mpc_new(const char *name) {
   mpc_parser_t *p = mpc_undefined();
   p->retained = 1;
@@ -1537,6 +2333,7 @@ mpc_parser_t *mpc_copy(mpc_parser_t *a) {
       break;
 
     case MPC_TYPE_OR:
+      p->data.or.dispatch = NULL;
       p->data.or.xs = malloc(a->data.or.n * sizeof(mpc_parser_t*));
       for (i = 0; i < a->data.or.n; i++) {
         p->data.or.xs[i] = mpc_copy(a->data.or.xs[i]);
@@ -1552,6 +2349,13 @@ mpc_parser_t *mpc_copy(mpc_parser_t *a) {
         p->data.and.dxs[i] = a->data.and.dxs[i];
       }
     break;
+    case MPC_TYPE_DFA:
+      p->data.dfa.x = mpc_copy(a->data.dfa.x);
+      p->data.dfa.next = malloc(a->data.dfa.n * 256);
+      memcpy(p->data.dfa.next, a->data.dfa.next, a->data.dfa.n * 256);
+      p->data.dfa.accept = malloc(a->data.dfa.n);
+      memcpy(p->data.dfa.accept, a->data.dfa.accept, a->data.dfa.n);
+    break;
 
     case MPC_TYPE_CHECK:
       p->data.check.x      = mpc_copy(a->data.check.x);
@@ -2354,6 +3158,8 @@ mpc_parser_t *mpc_re(const char *re) {
   return mpc_re_mode(re, MPC_RE_DEFAULT);
 }
 
+static mpc_parser_t *mpc_re_compile(mpc_parser_t *p);
+
 mpc_parser_t *mpc_re_mode(const char *re, int mode) {
 
   char *err_msg;
@@ -2417,7 +3223,7 @@ mpc_parser_t *mpc_re_mode(const char *re, int mode) {
 
   mpc_optimise(r.output);
 
-  return r.output;
+  return mpc_re_compile(r.output);
 
 }
 
@@ -2769,6 +3575,7 @@ static void mpc_print_unretained(mpc_parser_t *p, int force) {
   if (p->type == MPC_TYPE_APPLY)    { mpc_print_unretained(p->data.apply.x, 0); }
   if (p->type == MPC_TYPE_APPLY_TO) { mpc_print_unretained(p->data.apply_to.x, 0); }
   if (p->type == MPC_TYPE_PREDICT)  { mpc_print_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)      { mpc_print_unretained(p->data.dfa.x, 0); }
 
   if (p->type == MPC_TYPE_NOT)   { mpc_print_unretained(p->data.not.x, 0); printf("!"); }
   if (p->type == MPC_TYPE_MAYBE) { mpc_print_unretained(p->data.not.x, 0); printf("?"); }
@@ -2885,18 +3692,48 @@ int mpc_test_pass(mpc_parser_t *p, const char *s, const void *d,
 
 void mpc_ast_delete(mpc_ast_t *a) {
 
+  int i, n = 0, slots = 0;
+  mpc_ast_t **stack = NULL;
+
+  /* Children wait on a stack of their own, so deep trees cannot overflow the C stack */
+  while (a != NULL) {
+
+    if (n + a->children_num > slots) {
+      slots = (n + a->children_num) * 2;
+      stack = realloc(stack, sizeof(mpc_ast_t*) * slots);
+    }
+    for (i = 0; i < a->children_num; i++) {
+      stack[n++] = a->children[i];
+    }
+
+    free(a->children);
+    free(a->tag);
+    free(a->contents);
+    free(a);
+
+    a = n > 0 ? stack[--n] : NULL;
+  }
+
+  free(stack);
+
+}
+
+static mpc_ast_t *mpc_ast_copy(mpc_ast_t *a) {
+
   int i;
+  mpc_ast_t *c;
 
-  if (a == NULL) { return; }
+  if (a == NULL) { return NULL; }
 
+  c = mpc_ast_new(a->tag, a->contents);
+  c->state = a->state;
+  memcpy(c->rules, a->rules, sizeof(c->rules));
+  c->children_num = a->children_num;
+  c->children = malloc(sizeof(mpc_ast_t*) * a->children_num);
   for (i = 0; i < a->children_num; i++) {
-    mpc_ast_delete(a->children[i]);
+    c->children[i] = mpc_ast_copy(a->children[i]);
   }
-
-  free(a->children);
-  free(a->tag);
-  free(a->contents);
-  free(a);
+  return c;
 
 }
 
@@ -2921,6 +3758,7 @@ mpc_ast_t *mpc_ast_new(const char *tag, const char *contents) {
 
   a->children_num = 0;
   a->children = NULL;
+  memset(a->rules, 0, sizeof(a->rules));
   return a;
 
 }
@@ -3001,6 +3839,17 @@ mpc_ast_t *mpc_ast_tag(mpc_ast_t *a, const char *t) {
   return a;
 }
 
+mpc_ast_t *mpc_ast_add_rule(mpc_ast_t *a, int id) {
+  if (a == NULL || id < 0 || id >= MPC_AST_RULES) { return a; }
+  a->rules[id / 8] |= 1 << (id % 8);
+  return a;
+}
+
+int mpc_ast_has_rule(mpc_ast_t *a, int id) {
+  if (id < 0 || id >= MPC_AST_RULES) { return 0; }
+  return (a->rules[id / 8] >> (id % 8)) & 1;
+}
+
 mpc_ast_t *mpc_ast_state(mpc_ast_t *a, mpc_state_t s) {
   if (a == NULL) { return a; }
   a->state = s;
@@ -3229,6 +4078,7 @@ mpc_val_t *mpcf_fold_ast(int n, mpc_val_t **xs) {
     if        (as[i] && as[i]->children_num == 0) {
       mpc_ast_add_child(r, as[i]);
     } else if (as[i] && as[i]->children_num == 1) {
+      for (j = 0; j < MPC_AST_RULES / 8; j++) { as[i]->children[0]->rules[j] |= as[i]->rules[j]; }
       mpc_ast_add_child(r, mpc_ast_add_root_tag(as[i]->children[0], as[i]->tag));
       mpc_ast_delete_no_children(as[i]);
     } else if (as[i] && as[i]->children_num >= 2) {
@@ -3381,6 +4231,7 @@ typedef struct {
   int parsers_num;
   mpc_parser_t **parsers;
   int flags;
+  const char *error;
 } mpca_grammar_st_t;
 
 static mpc_val_t *mpcaf_grammar_or(int n, mpc_val_t **xs) {
@@ -3505,6 +4356,12 @@ static mpc_parser_t *mpca_grammar_find_parser(char *x, mpca_grammar_st_t *st) {
 
 }
 
+/* Tags a node with the name and id of the rule it was parsed by */
+static mpc_val_t *mpcaf_grammar_rule(mpc_val_t *x, void *p) {
+  mpc_parser_t *rule = p;
+  return mpc_ast_add_rule(mpc_ast_add_tag(x, rule->name), rule->rule);
+}
+
 static mpc_val_t *mpcaf_grammar_id(mpc_val_t *x, void *s) {
 
   mpca_grammar_st_t *st = s;
@@ -3512,7 +4369,7 @@ static mpc_val_t *mpcaf_grammar_id(mpc_val_t *x, void *s) {
   free(x);
 
   if (p->name) {
-    return mpca_state(mpca_root(mpca_add_tag(p, p->name)));
+    return mpca_state(mpca_root(mpc_apply_to(p, mpcaf_grammar_rule, p)));
   } else {
     return mpca_state(mpca_root(p));
   }
@@ -3595,6 +4452,7 @@ mpc_parser_t *mpca_grammar(int flags, const char *grammar, ...) {
   st.parsers_num = 0;
   st.parsers = NULL;
   st.flags = flags;
+  st.error = NULL;
 
   res = mpca_grammar_st(grammar, &st);
   free(st.parsers);
@@ -3649,26 +4507,49 @@ static void mpca_stmt_list_delete(mpc_val_t *x) {
 
 }
 
+static void mpc_dispatch_unretained(mpc_parser_t *p, int force);
+
 static mpc_val_t *mpca_stmt_list_apply_to(mpc_val_t *x, void *s) {
 
+  int j, n;
   mpca_grammar_st_t *st = s;
   mpca_stmt_t *stmt;
   mpca_stmt_t **stmts = x;
   mpc_parser_t *left;
+  mpc_parser_t **lefts;
 
-  while(*stmts) {
-    stmt = *stmts;
+  for (n = 0; stmts[n]; n++);
+
+  /* Rule ids index the set of rules kept in each AST node, so there cannot be more */
+  if (n > MPC_AST_RULES) {
+    st->error = "Grammar has more rules than fit in an AST!";
+    mpca_stmt_list_delete(x);
+    return NULL;
+  }
+
+  lefts = malloc(sizeof(mpc_parser_t*) * (n + 1));
+
+  for (j = 0; j < n; j++) {
+    stmt = stmts[j];
     left = mpca_grammar_find_parser(stmt->ident, st);
     if (st->flags & MPCA_LANG_PREDICTIVE) { stmt->grammar = mpc_predictive(stmt->grammar); }
     if (stmt->name) { stmt->grammar = mpc_expect(stmt->grammar, stmt->name); }
     mpc_optimise(stmt->grammar);
     mpc_define(left, stmt->grammar);
+    left->rule = j;
+    left->ast = 1;
+    lefts[j] = left;
     free(stmt->ident);
     free(stmt->name);
     free(stmt);
-    stmts++;
   }
 
+  /* Rules can refer to ones defined after them, so dispatch tables are only built once all are defined */
+  for (j = 0; j < n; j++) {
+    mpc_dispatch_unretained(lefts[j], 1);
+  }
+
+  free(lefts);
   free(x);
 
   return NULL;
@@ -3734,6 +4615,8 @@ static mpc_err_t *mpca_lang_st(mpc_input_t *i, mpca_grammar_st_t *st) {
 
   if (!mpc_parse_input(i, Lang, &r)) {
     e = r.error;
+  } else if (st->error) {
+    e = mpc_err_file(i->filename, st->error);
   } else {
     e = NULL;
   }
@@ -3755,6 +4638,7 @@ mpc_err_t *mpca_lang_file(int flags, FILE *f, ...) {
   st.parsers_num = 0;
   st.parsers = NULL;
   st.flags = flags;
+  st.error = NULL;
 
   i = mpc_input_new_file("<mpca_lang_file>", f);
   err = mpca_lang_st(i, &st);
@@ -3777,6 +4661,7 @@ mpc_err_t *mpca_lang_pipe(int flags, FILE *p, ...) {
   st.parsers_num = 0;
   st.parsers = NULL;
   st.flags = flags;
+  st.error = NULL;
 
   i = mpc_input_new_pipe("<mpca_lang_pipe>", p);
   err = mpca_lang_st(i, &st);
@@ -3800,6 +4685,7 @@ mpc_err_t *mpca_lang(int flags, const char *language, ...) {
   st.parsers_num = 0;
   st.parsers = NULL;
   st.flags = flags;
+  st.error = NULL;
 
   i = mpc_input_new_string("<mpca_lang>", language);
   err = mpca_lang_st(i, &st);
@@ -3831,6 +4717,7 @@ mpc_err_t *mpca_lang_contents(int flags, const char *filename, ...) {
   st.parsers_num = 0;
   st.parsers = NULL;
   st.flags = flags;
+  st.error = NULL;
 
   i = mpc_input_new_file(filename, f);
   err = mpca_lang_st(i, &st);
@@ -3844,70 +4731,604 @@ mpc_err_t *mpca_lang_contents(int flags, const char *filename, ...) {
   return err;
 }
 
-static int mpc_nodecount_unretained(mpc_parser_t* p, int force) {
+/*
+** Grammar Tables
+**
+** A grammar can be written out once it is built,
+** as a C array, using `mpca_tables_write` and be
+** brought back with `mpca_tables`, so a program
+** need not parse and optimise its grammar, or
+** compile its regexes, every time it starts.
+**
+** Each rule is written as its name, its id and
+** its tree of parsers, with references to rules as
+** their position in the list given. Strings and
+** the dispatch and regex tables are written as
+** they are. Functions are written as a position in
+** the list below, so only grammars made from mpc's
+** own functions, as those of `mpca_lang` are, can
+** be written out. The version must be changed when
+** the list or the layout changes.
+*/
 
-  int i, total;
+enum {
+  MPC_TABLES_VERSION = 2,
+  MPC_TABLES_RULE    = 0xFE,
+  MPC_TABLES_NONE    = 0xFF
+};
 
-  if (p->retained && !force) { return 0; }
+typedef void(*mpc_tables_fn_t)(void);
+
+static const mpc_tables_fn_t mpc_tables_fns[] = {
+  (mpc_tables_fn_t)free,
+  (mpc_tables_fn_t)mpcf_dtor_null,
+  (mpc_tables_fn_t)mpc_ast_delete,
+  (mpc_tables_fn_t)mpc_soft_delete,
+  (mpc_tables_fn_t)mpcf_ctor_null,
+  (mpc_tables_fn_t)mpcf_ctor_str,
+  (mpc_tables_fn_t)mpcf_free,
+  (mpc_tables_fn_t)mpcf_int,
+  (mpc_tables_fn_t)mpcf_hex,
+  (mpc_tables_fn_t)mpcf_oct,
+  (mpc_tables_fn_t)mpcf_float,
+  (mpc_tables_fn_t)mpcf_strtriml,
+  (mpc_tables_fn_t)mpcf_strtrimr,
+  (mpc_tables_fn_t)mpcf_strtrim,
+  (mpc_tables_fn_t)mpcf_escape,
+  (mpc_tables_fn_t)mpcf_escape_regex,
+  (mpc_tables_fn_t)mpcf_escape_string_raw,
+  (mpc_tables_fn_t)mpcf_escape_char_raw,
+  (mpc_tables_fn_t)mpcf_unescape,
+  (mpc_tables_fn_t)mpcf_unescape_regex,
+  (mpc_tables_fn_t)mpcf_unescape_string_raw,
+  (mpc_tables_fn_t)mpcf_unescape_char_raw,
+  (mpc_tables_fn_t)mpcf_null,
+  (mpc_tables_fn_t)mpcf_fst,
+  (mpc_tables_fn_t)mpcf_snd,
+  (mpc_tables_fn_t)mpcf_trd,
+  (mpc_tables_fn_t)mpcf_fst_free,
+  (mpc_tables_fn_t)mpcf_snd_free,
+  (mpc_tables_fn_t)mpcf_trd_free,
+  (mpc_tables_fn_t)mpcf_all_free,
+  (mpc_tables_fn_t)mpcf_strfold,
+  (mpc_tables_fn_t)mpcf_maths,
+  (mpc_tables_fn_t)mpcf_fold_ast,
+  (mpc_tables_fn_t)mpcf_str_ast,
+  (mpc_tables_fn_t)mpcf_state_ast,
+  (mpc_tables_fn_t)mpc_ast_add_root,
+  (mpc_tables_fn_t)mpc_ast_tag,
+  (mpc_tables_fn_t)mpc_ast_add_tag,
+  (mpc_tables_fn_t)mpcaf_grammar_rule,
+  (mpc_tables_fn_t)mpc_boundary_anchor,
+  (mpc_tables_fn_t)mpc_boundary_newline_anchor,
+  NULL
+};
 
-  if (p->type == MPC_TYPE_EXPECT) { return 1 + mpc_nodecount_unretained(p->data.expect.x, 0); }
+typedef struct {
+  unsigned char *data;
+  size_t len;
+  size_t cap;
+  mpc_parser_t **rules;
+  int rules_num;
+  const char *error;
+} mpc_tables_out_t;
+
+static void mpc_tables_put(mpc_tables_out_t *t, const void *x, size_t n) {
+  if (t->len + n > t->cap) {
+    t->cap = (t->len + n) * 2;
+    t->data = realloc(t->data, t->cap);
+  }
+  memcpy(t->data + t->len, x, n);
+  t->len += n;
+}
 
-  if (p->type == MPC_TYPE_APPLY)    { return 1 + mpc_nodecount_unretained(p->data.apply.x, 0); }
-  if (p->type == MPC_TYPE_APPLY_TO) { return 1 + mpc_nodecount_unretained(p->data.apply_to.x, 0); }
-  if (p->type == MPC_TYPE_PREDICT)  { return 1 + mpc_nodecount_unretained(p->data.predict.x, 0); }
+static void mpc_tables_put_byte(mpc_tables_out_t *t, int x) {
+  unsigned char c = (unsigned char)x;
+  mpc_tables_put(t, &c, 1);
+}
 
-  if (p->type == MPC_TYPE_CHECK)    { return 1 + mpc_nodecount_unretained(p->data.check.x, 0); }
-  if (p->type == MPC_TYPE_CHECK_WITH) { return 1 + mpc_nodecount_unretained(p->data.check_with.x, 0); }
+static void mpc_tables_put_int(mpc_tables_out_t *t, long x) {
+  int k;
+  for (k = 0; k < 4; k++) { mpc_tables_put_byte(t, (int)((unsigned long)x >> (8 * k))); }
+}
 
-  if (p->type == MPC_TYPE_NOT)   { return 1 + mpc_nodecount_unretained(p->data.not.x, 0); }
-  if (p->type == MPC_TYPE_MAYBE) { return 1 + mpc_nodecount_unretained(p->data.not.x, 0); }
+/* Strings keep their terminator so they can be used where they lie */
+static void mpc_tables_put_str(mpc_tables_out_t *t, const char *x) {
+  if (x == NULL) { mpc_tables_put_int(t, -1); return; }
+  mpc_tables_put_int(t, (long)strlen(x));
+  mpc_tables_put(t, x, strlen(x) + 1);
+}
 
-  if (p->type == MPC_TYPE_MANY)  { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
-  if (p->type == MPC_TYPE_MANY1) { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
-  if (p->type == MPC_TYPE_COUNT) { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
+static void mpc_tables_put_fn(mpc_tables_out_t *t, mpc_tables_fn_t f) {
+  int k;
+  if (f == NULL) { mpc_tables_put_byte(t, MPC_TABLES_NONE); return; }
+  for (k = 0; mpc_tables_fns[k]; k++) {
+    if (mpc_tables_fns[k] == f) { mpc_tables_put_byte(t, k); return; }
+  }
+  t->error = "Grammar uses a function mpc cannot write out!";
+}
 
-  if (p->type == MPC_TYPE_OR) {
-    total = 1;
-    for(i = 0; i < p->data.or.n; i++) {
-      total += mpc_nodecount_unretained(p->data.or.xs[i], 0);
-    }
-    return total;
+static void mpc_tables_put_rule(mpc_tables_out_t *t, mpc_parser_t *p) {
+  int k;
+  for (k = 0; k < t->rules_num; k++) {
+    if (t->rules[k] == p) { mpc_tables_put_int(t, k); return; }
   }
+  t->error = "Grammar refers to a parser not being written out!";
+}
 
-  if (p->type == MPC_TYPE_AND) {
-    total = 1;
-    for(i = 0; i < p->data.and.n; i++) {
-      total += mpc_nodecount_unretained(p->data.and.xs[i], 0);
-    }
-    return total;
+static void mpc_tables_put_parser(mpc_tables_out_t *t, mpc_parser_t *p, int force) {
+
+  int k;
+
+  if (p->retained && !force) {
+    mpc_tables_put_byte(t, MPC_TABLES_RULE);
+    mpc_tables_put_rule(t, p);
+    return;
   }
 
-  return 1;
+  mpc_tables_put_byte(t, p->type);
+  mpc_tables_put_byte(t, p->packrat | p->ast << 1);
+  if (!force) { mpc_tables_put_str(t, p->name); }
 
-}
+  switch (p->type) {
 
-void mpc_stats(mpc_parser_t* p) {
-  printf("Stats\n");
-  printf("=====\n");
-  printf("Node Count: %i\n", mpc_nodecount_unretained(p, 1));
-}
+    case MPC_TYPE_UNDEFINED:
+      t->error = "Grammar has an undefined parser!";
+      break;
 
-static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
+    case MPC_TYPE_FAIL: mpc_tables_put_str(t, p->data.fail.m); break;
 
-  int i, n, m;
-  mpc_parser_t *t;
+    case MPC_TYPE_LIFT: mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.lift.lf); break;
 
-  if (p->retained && !force) { return; }
+    case MPC_TYPE_EXPECT:
+      mpc_tables_put_parser(t, p->data.expect.x, 0);
+      mpc_tables_put_str(t, p->data.expect.m);
+      break;
 
-  /* Optimise Subexpressions */
+    case MPC_TYPE_ANCHOR: mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.anchor.f); break;
 
-  if (p->type == MPC_TYPE_EXPECT)     { mpc_optimise_unretained(p->data.expect.x, 0); }
-  if (p->type == MPC_TYPE_APPLY)      { mpc_optimise_unretained(p->data.apply.x, 0); }
-  if (p->type == MPC_TYPE_APPLY_TO)   { mpc_optimise_unretained(p->data.apply_to.x, 0); }
-  if (p->type == MPC_TYPE_CHECK)      { mpc_optimise_unretained(p->data.check.x, 0); }
-  if (p->type == MPC_TYPE_CHECK_WITH) { mpc_optimise_unretained(p->data.check_with.x, 0); }
-  if (p->type == MPC_TYPE_PREDICT)    { mpc_optimise_unretained(p->data.predict.x, 0); }
-  if (p->type == MPC_TYPE_NOT)        { mpc_optimise_unretained(p->data.not.x, 0); }
+    case MPC_TYPE_SINGLE: mpc_tables_put_byte(t, p->data.single.x); break;
+
+    case MPC_TYPE_RANGE:
+      mpc_tables_put_byte(t, p->data.range.x);
+      mpc_tables_put_byte(t, p->data.range.y);
+      break;
+
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+    case MPC_TYPE_STRING:
+      mpc_tables_put_str(t, p->data.string.x);
+      break;
+
+    case MPC_TYPE_APPLY:
+      mpc_tables_put_parser(t, p->data.apply.x, 0);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.apply.f);
+      break;
+
+    case MPC_TYPE_APPLY_TO:
+      mpc_tables_put_parser(t, p->data.apply_to.x, 0);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.apply_to.f);
+      if (p->data.apply_to.f == mpcaf_grammar_rule) {
+        mpc_tables_put_rule(t, p->data.apply_to.d);
+      } else if (p->data.apply_to.f == (mpc_apply_to_t)mpc_ast_tag
+             ||  p->data.apply_to.f == (mpc_apply_to_t)mpc_ast_add_tag) {
+        mpc_tables_put_str(t, p->data.apply_to.d);
+      } else {
+        t->error = "Grammar uses a function mpc cannot write out!";
+      }
+      break;
+
+    case MPC_TYPE_PREDICT: mpc_tables_put_parser(t, p->data.predict.x, 0); break;
+
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_NOT:
+      mpc_tables_put_parser(t, p->data.not.x, 0);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.not.dx);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.not.lf);
+      break;
+
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      mpc_tables_put_int(t, p->data.repeat.n);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.repeat.f);
+      mpc_tables_put_parser(t, p->data.repeat.x, 0);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.repeat.dx);
+      break;
+
+    case MPC_TYPE_OR:
+      mpc_tables_put_int(t, p->data.or.n);
+      for (k = 0; k < p->data.or.n; k++) { mpc_tables_put_parser(t, p->data.or.xs[k], 0); }
+      mpc_tables_put_byte(t, p->data.or.dispatch != NULL);
+      if (p->data.or.dispatch) { mpc_tables_put(t, p->data.or.dispatch, 256 * (p->data.or.n + 1)); }
+      break;
+
+    case MPC_TYPE_AND:
+      mpc_tables_put_int(t, p->data.and.n);
+      mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.and.f);
+      for (k = 0; k < p->data.and.n; k++) { mpc_tables_put_parser(t, p->data.and.xs[k], 0); }
+      for (k = 0; k < p->data.and.n - 1; k++) { mpc_tables_put_fn(t, (mpc_tables_fn_t)p->data.and.dxs[k]); }
+      break;
+
+    case MPC_TYPE_DFA:
+      mpc_tables_put_parser(t, p->data.dfa.x, 0);
+      mpc_tables_put_int(t, p->data.dfa.n);
+      mpc_tables_put(t, p->data.dfa.next, 256 * p->data.dfa.n);
+      mpc_tables_put(t, p->data.dfa.accept, p->data.dfa.n);
+      break;
+
+    case MPC_TYPE_LIFT_VAL:
+    case MPC_TYPE_SATISFY:
+    case MPC_TYPE_CHECK:
+    case MPC_TYPE_CHECK_WITH:
+      t->error = "Grammar uses a function mpc cannot write out!";
+      break;
+
+    default: break;
+  }
+
+}
+
+mpc_err_t *mpca_tables_write(FILE *f, const char *name, int n, ...) {
+
+  int j;
+  size_t k;
+  mpc_tables_out_t t;
+  mpc_err_t *err = NULL;
+  va_list va;
+
+  t.data = NULL;
+  t.len = 0;
+  t.cap = 0;
+  t.rules = malloc(sizeof(mpc_parser_t*) * n);
+  t.rules_num = n;
+  t.error = NULL;
+
+  va_start(va, n);
+  for (j = 0; j < n; j++) { t.rules[j] = va_arg(va, mpc_parser_t*); }
+  va_end(va);
+
+  mpc_tables_put(&t, "MPCT", 4);
+  mpc_tables_put_byte(&t, MPC_TABLES_VERSION);
+  mpc_tables_put_int(&t, n);
+  for (j = 0; j < n; j++) {
+    mpc_tables_put_str(&t, t.rules[j]->name);
+    mpc_tables_put_int(&t, t.rules[j]->rule);
+    mpc_tables_put_parser(&t, t.rules[j], 1);
+  }
+
+  if (t.error) {
+    err = mpc_err_file("<mpca_tables_write>", t.error);
+  } else {
+    fprintf(f, "static const unsigned char %s[] = {", name);
+    for (k = 0; k < t.len; k++) {
+      fprintf(f, k % 16 ? " 0x%02x," : "\n  0x%02x,", t.data[k]);
+    }
+    fprintf(f, "\n};\n");
+  }
+
+  free(t.data);
+  free(t.rules);
+  return err;
+}
+
+typedef struct {
+  const unsigned char *p;
+  const unsigned char *end;
+  mpc_parser_t **rules;
+  int rules_num;
+  const char *error;
+} mpc_tables_in_t;
+
+static const unsigned char *mpc_tables_get(mpc_tables_in_t *t, size_t n) {
+  const unsigned char *x = t->p;
+  if ((size_t)(t->end - t->p) < n) {
+    t->error = "Grammar tables are truncated!";
+    t->p = t->end;
+    return NULL;
+  }
+  t->p += n;
+  return x;
+}
+
+static int mpc_tables_get_byte(mpc_tables_in_t *t) {
+  const unsigned char *x = mpc_tables_get(t, 1);
+  return x ? x[0] : 0;
+}
+
+static long mpc_tables_get_int(mpc_tables_in_t *t) {
+  const unsigned char *x = mpc_tables_get(t, 4);
+  unsigned long v;
+  if (x == NULL) { return 0; }
+  v = (unsigned long)x[0] | (unsigned long)x[1] << 8 | (unsigned long)x[2] << 16 | (unsigned long)x[3] << 24;
+  return v & 0x80000000UL ? -(long)(~v & 0x7FFFFFFFUL) - 1 : (long)v;
+}
+
+/* Gives a string where it lies in the tables */
+static const char *mpc_tables_get_str(mpc_tables_in_t *t) {
+  long n = mpc_tables_get_int(t);
+  const unsigned char *x;
+  if (n < 0) { return NULL; }
+  x = mpc_tables_get(t, (size_t)n + 1);
+  if (x == NULL || x[n] != '\0') {
+    t->error = "Grammar tables are truncated!";
+    return "";
+  }
+  return (const char*)x;
+}
+
+static char *mpc_tables_get_str_copy(mpc_tables_in_t *t) {
+  const char *x = mpc_tables_get_str(t);
+  char *y;
+  if (x == NULL) { return NULL; }
+  y = malloc(strlen(x) + 1);
+  strcpy(y, x);
+  return y;
+}
+
+static unsigned char *mpc_tables_get_copy(mpc_tables_in_t *t, size_t n) {
+  const unsigned char *x = mpc_tables_get(t, n);
+  unsigned char *y = calloc(n ? n : 1, 1);
+  if (x) { memcpy(y, x, n); }
+  return y;
+}
+
+static mpc_tables_fn_t mpc_tables_get_fn(mpc_tables_in_t *t) {
+  int k = mpc_tables_get_byte(t);
+  if (k == MPC_TABLES_NONE) { return NULL; }
+  if (k >= (int)(sizeof(mpc_tables_fns) / sizeof(mpc_tables_fn_t)) - 1) {
+    t->error = "Grammar tables use an unknown function!";
+    return NULL;
+  }
+  return mpc_tables_fns[k];
+}
+
+static mpc_parser_t *mpc_tables_get_rule(mpc_tables_in_t *t) {
+  long k = mpc_tables_get_int(t);
+  if (k < 0 || k >= t->rules_num) {
+    t->error = "Grammar tables refer to an unknown rule!";
+    return t->rules[0];
+  }
+  return t->rules[k];
+}
+
+/* Counts are checked against what is left so a bad table cannot ask for huge arrays */
+static int mpc_tables_get_count(mpc_tables_in_t *t, size_t each) {
+  long n = mpc_tables_get_int(t);
+  if (n < 0 || (size_t)n > (size_t)(t->end - t->p) / each) {
+    t->error = "Grammar tables are truncated!";
+    return 0;
+  }
+  return (int)n;
+}
+
+static mpc_parser_t *mpc_tables_get_parser(mpc_tables_in_t *t, mpc_parser_t *p) {
+
+  int k, type;
+
+  type = mpc_tables_get_byte(t);
+  if (type == MPC_TABLES_RULE) { return mpc_tables_get_rule(t); }
+
+  if (p == NULL) {
+    p = mpc_undefined();
+    k = mpc_tables_get_byte(t);
+    p->name = mpc_tables_get_str_copy(t);
+  } else {
+    k = mpc_tables_get_byte(t);
+  }
+  p->packrat = k & 1;
+  p->ast = (k >> 1) & 1;
+
+  /* Anything unreadable stays undefined, so it can still be deleted */
+  if (t->error || type > MPC_TYPE_DFA) {
+    if (!t->error) { t->error = "Grammar tables have an unknown parser!"; }
+    return p;
+  }
+  p->type = type;
+
+  switch (type) {
+
+    case MPC_TYPE_FAIL: p->data.fail.m = mpc_tables_get_str_copy(t); break;
+
+    case MPC_TYPE_LIFT: p->data.lift.lf = (mpc_ctor_t)mpc_tables_get_fn(t); break;
+
+    case MPC_TYPE_EXPECT:
+      p->data.expect.x = mpc_tables_get_parser(t, NULL);
+      p->data.expect.m = mpc_tables_get_str_copy(t);
+      break;
+
+    case MPC_TYPE_ANCHOR: p->data.anchor.f = (int(*)(char,char))mpc_tables_get_fn(t); break;
+
+    case MPC_TYPE_SINGLE: p->data.single.x = (char)mpc_tables_get_byte(t); break;
+
+    case MPC_TYPE_RANGE:
+      p->data.range.x = (char)mpc_tables_get_byte(t);
+      p->data.range.y = (char)mpc_tables_get_byte(t);
+      break;
+
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+    case MPC_TYPE_STRING:
+      p->data.string.x = mpc_tables_get_str_copy(t);
+      if (p->data.string.x == NULL) { p->data.string.x = calloc(1, 1); }
+      break;
+
+    case MPC_TYPE_APPLY:
+      p->data.apply.x = mpc_tables_get_parser(t, NULL);
+      p->data.apply.f = (mpc_apply_t)mpc_tables_get_fn(t);
+      break;
+
+    case MPC_TYPE_APPLY_TO:
+      p->data.apply_to.x = mpc_tables_get_parser(t, NULL);
+      p->data.apply_to.f = (mpc_apply_to_t)mpc_tables_get_fn(t);
+      if (p->data.apply_to.f == mpcaf_grammar_rule) {
+        p->data.apply_to.d = mpc_tables_get_rule(t);
+      } else {
+        p->data.apply_to.d = (void*)mpc_tables_get_str(t);
+      }
+      break;
+
+    case MPC_TYPE_PREDICT: p->data.predict.x = mpc_tables_get_parser(t, NULL); break;
+
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_NOT:
+      p->data.not.x = mpc_tables_get_parser(t, NULL);
+      p->data.not.dx = (mpc_dtor_t)mpc_tables_get_fn(t);
+      p->data.not.lf = (mpc_ctor_t)mpc_tables_get_fn(t);
+      break;
+
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      p->data.repeat.n = (int)mpc_tables_get_int(t);
+      p->data.repeat.f = (mpc_fold_t)mpc_tables_get_fn(t);
+      p->data.repeat.x = mpc_tables_get_parser(t, NULL);
+      p->data.repeat.dx = (mpc_dtor_t)mpc_tables_get_fn(t);
+      break;
+
+    case MPC_TYPE_OR:
+      p->data.or.n = mpc_tables_get_count(t, 1);
+      p->data.or.xs = malloc(sizeof(mpc_parser_t*) * (p->data.or.n + 1));
+      for (k = 0; k < p->data.or.n; k++) { p->data.or.xs[k] = mpc_tables_get_parser(t, NULL); }
+      p->data.or.dispatch = NULL;
+      if (mpc_tables_get_byte(t)) {
+        p->data.or.dispatch = mpc_tables_get_copy(t, 256 * (p->data.or.n + 1));
+      }
+      break;
+
+    case MPC_TYPE_AND:
+      p->data.and.n = mpc_tables_get_count(t, 1);
+      p->data.and.f = (mpc_fold_t)mpc_tables_get_fn(t);
+      p->data.and.xs = malloc(sizeof(mpc_parser_t*) * (p->data.and.n + 1));
+      p->data.and.dxs = malloc(sizeof(mpc_dtor_t) * (p->data.and.n + 1));
+      for (k = 0; k < p->data.and.n; k++) { p->data.and.xs[k] = mpc_tables_get_parser(t, NULL); }
+      for (k = 0; k < p->data.and.n - 1; k++) { p->data.and.dxs[k] = (mpc_dtor_t)mpc_tables_get_fn(t); }
+      break;
+
+    case MPC_TYPE_DFA:
+      p->data.dfa.x = mpc_tables_get_parser(t, NULL);
+      p->data.dfa.n = mpc_tables_get_count(t, 257);
+      p->data.dfa.next = mpc_tables_get_copy(t, 256 * p->data.dfa.n);
+      p->data.dfa.accept = mpc_tables_get_copy(t, p->data.dfa.n);
+      break;
+
+    default: break;
+  }
+
+  return p;
+}
+
+mpc_err_t *mpca_tables(const unsigned char *tables, size_t len, int n, ...) {
+
+  int j;
+  const char *name;
+  mpc_tables_in_t t;
+  va_list va;
+
+  t.p = tables;
+  t.end = tables + len;
+  t.rules = malloc(sizeof(mpc_parser_t*) * n);
+  t.rules_num = n;
+  t.error = NULL;
+
+  va_start(va, n);
+  for (j = 0; j < n; j++) { t.rules[j] = va_arg(va, mpc_parser_t*); }
+  va_end(va);
+
+  if (len < 5 || memcmp(tables, "MPCT", 4) != 0 || tables[4] != MPC_TABLES_VERSION) {
+    t.error = "Grammar tables are not for this version of mpc!";
+  }
+  t.p += 5;
+
+  if (!t.error && mpc_tables_get_int(&t) != n) {
+    t.error = "Grammar tables have a different number of rules!";
+  }
+
+  for (j = 0; j < n && !t.error; j++) {
+    name = mpc_tables_get_str(&t);
+    if (name == NULL || t.rules[j]->name == NULL || strcmp(name, t.rules[j]->name) != 0) {
+      t.error = "Grammar tables have rules in a different order!";
+      break;
+    }
+    mpc_undefine(t.rules[j]);
+    t.rules[j]->rule = (int)mpc_tables_get_int(&t);
+    mpc_tables_get_parser(&t, t.rules[j]);
+  }
+
+  if (t.error) {
+    for (j = 0; j < n; j++) { mpc_undefine(t.rules[j]); }
+  }
+
+  free(t.rules);
+  return t.error ? mpc_err_file("<mpca_tables>", t.error) : NULL;
+}
+
+static int mpc_nodecount_unretained(mpc_parser_t* p, int force) {
+
+  int i, total;
+
+  if (p->retained && !force) { return 0; }
+
+  if (p->type == MPC_TYPE_EXPECT) { return 1 + mpc_nodecount_unretained(p->data.expect.x, 0); }
+
+  if (p->type == MPC_TYPE_APPLY)    { return 1 + mpc_nodecount_unretained(p->data.apply.x, 0); }
+  if (p->type == MPC_TYPE_APPLY_TO) { return 1 + mpc_nodecount_unretained(p->data.apply_to.x, 0); }
+  if (p->type == MPC_TYPE_PREDICT)  { return 1 + mpc_nodecount_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)      { return 1 + mpc_nodecount_unretained(p->data.dfa.x, 0); }
+
+  if (p->type == MPC_TYPE_CHECK)    { return 1 + mpc_nodecount_unretained(p->data.check.x, 0); }
+  if (p->type == MPC_TYPE_CHECK_WITH) { return 1 + mpc_nodecount_unretained(p->data.check_with.x, 0); }
+
+  if (p->type == MPC_TYPE_NOT)   { return 1 + mpc_nodecount_unretained(p->data.not.x, 0); }
+  if (p->type == MPC_TYPE_MAYBE) { return 1 + mpc_nodecount_unretained(p->data.not.x, 0); }
+
+  if (p->type == MPC_TYPE_MANY)  { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
+  if (p->type == MPC_TYPE_MANY1) { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
+  if (p->type == MPC_TYPE_COUNT) { return 1 + mpc_nodecount_unretained(p->data.repeat.x, 0); }
+
+  if (p->type == MPC_TYPE_OR) {
+    total = 1;
+    for(i = 0; i < p->data.or.n; i++) {
+      total += mpc_nodecount_unretained(p->data.or.xs[i], 0);
+    }
+    return total;
+  }
+
+  if (p->type == MPC_TYPE_AND) {
+    total = 1;
+    for(i = 0; i < p->data.and.n; i++) {
+      total += mpc_nodecount_unretained(p->data.and.xs[i], 0);
+    }
+    return total;
+  }
+
+  return 1;
+
+}
+
+void mpc_stats(mpc_parser_t* p) {
+  printf("Stats\n");
+  printf("=====\n");
+  printf("Node Count: %i\n", mpc_nodecount_unretained(p, 1));
+}
+
+static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
+
+  int i, n, m;
+  mpc_parser_t *t;
+
+  if (p->retained && !force) { return; }
+
+  /* Optimise Subexpressions */
+
+  if (p->type == MPC_TYPE_EXPECT)     { mpc_optimise_unretained(p->data.expect.x, 0); }
+  if (p->type == MPC_TYPE_APPLY)      { mpc_optimise_unretained(p->data.apply.x, 0); }
+  if (p->type == MPC_TYPE_APPLY_TO)   { mpc_optimise_unretained(p->data.apply_to.x, 0); }
+  if (p->type == MPC_TYPE_CHECK)      { mpc_optimise_unretained(p->data.check.x, 0); }
+  if (p->type == MPC_TYPE_CHECK_WITH) { mpc_optimise_unretained(p->data.check_with.x, 0); }
+  if (p->type == MPC_TYPE_PREDICT)    { mpc_optimise_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)        { mpc_optimise_unretained(p->data.dfa.x, 0); }
+  if (p->type == MPC_TYPE_NOT)        { mpc_optimise_unretained(p->data.not.x, 0); }
   if (p->type == MPC_TYPE_MAYBE)      { mpc_optimise_unretained(p->data.not.x, 0); }
   if (p->type == MPC_TYPE_MANY)       { mpc_optimise_unretained(p->data.repeat.x, 0); }
   if (p->type == MPC_TYPE_MANY1)      { mpc_optimise_unretained(p->data.repeat.x, 0); }
@@ -3917,6 +5338,8 @@ static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
     for(i = 0; i < p->data.or.n; i++) {
       mpc_optimise_unretained(p->data.or.xs[i], 0);
     }
+    free(p->data.or.dispatch);
+    p->data.or.dispatch = NULL;
   }
 
   if (p->type == MPC_TYPE_AND) {
@@ -3938,7 +5361,7 @@ static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
       p->data.or.n = n + m - 1;
       p->data.or.xs = realloc(p->data.or.xs, sizeof(mpc_parser_t*) * (n + m -1));
       memmove(p->data.or.xs + n - 1, t->data.or.xs, m * sizeof(mpc_parser_t*));
-      free(t->data.or.xs); free(t->name); free(t);
+      free(t->data.or.xs); free(t->data.or.dispatch); free(t->name); free(t);
       continue;
     }
 
@@ -3952,7 +5375,7 @@ static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
       p->data.or.xs = realloc(p->data.or.xs, sizeof(mpc_parser_t*) * (n + m -1));
       memmove(p->data.or.xs + m, p->data.or.xs + 1, (n - 1) * sizeof(mpc_parser_t*));
       memmove(p->data.or.xs, t->data.or.xs, m * sizeof(mpc_parser_t*));
-      free(t->data.or.xs); free(t->name); free(t);
+      free(t->data.or.xs); free(t->data.or.dispatch); free(t->name); free(t);
       continue;
     }
 
@@ -4061,7 +5484,413 @@ static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
 
 }
 
+/*
+** First Sets
+**
+** The characters a parser can start with, and
+** whether it can succeed without consuming any.
+** A parser that is not understood, or nests too
+** deeply, is taken to possibly consume nothing.
+*/
+
+enum {
+  MPC_FIRST_DEPTH = 64
+};
+
+static void mpc_first_add(unsigned char *set, int c) {
+  if (c != '\0') { set[(unsigned char)c / 8] |= 1 << ((unsigned char)c % 8); }
+}
+
+static int mpc_first_has(const unsigned char *set, int c) {
+  return set[c / 8] & (1 << (c % 8));
+}
+
+/* Adds the characters a single character parser accepts, returning 0 for other parsers */
+static int mpc_first_class(mpc_parser_t *p, unsigned char *set) {
+
+  int i, in;
+  char c;
+
+  for (i = 1; i < 256; i++) {
+    c = (char)i;
+    switch (p->type) {
+      case MPC_TYPE_ANY:    in = 1; break;
+      case MPC_TYPE_SINGLE: in = c == p->data.single.x; break;
+      case MPC_TYPE_RANGE:  in = c >= p->data.range.x && c <= p->data.range.y; break;
+      case MPC_TYPE_ONEOF:  in = strchr(p->data.string.x, c) != 0; break;
+      case MPC_TYPE_NONEOF: in = strchr(p->data.string.x, c) == 0; break;
+      default: return 0;
+    }
+    if (in) { mpc_first_add(set, i); }
+  }
+
+  return 1;
+}
+
+static int mpc_first(mpc_parser_t *p, unsigned char *set, int depth) {
+
+  int i, empty;
+
+  if (depth == MPC_FIRST_DEPTH) { return 1; }
+
+  switch (p->type) {
+
+    case MPC_TYPE_SATISFY:
+      for (i = 1; i < 256; i++) { mpc_first_add(set, i); }
+      return 0;
+
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SINGLE:
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+      mpc_first_class(p, set);
+      return 0;
+
+    case MPC_TYPE_DFA:
+      for (i = 1; i < 256; i++) {
+        if (p->data.dfa.next[i] != MPC_DFA_STOP) { mpc_first_add(set, i); }
+      }
+      return p->data.dfa.accept[0];
+
+    case MPC_TYPE_STRING:
+      mpc_first_add(set, p->data.string.x[0]);
+      return p->data.string.x[0] == '\0';
+
+    case MPC_TYPE_FAIL:      return 0;
+    case MPC_TYPE_UNDEFINED: return 1;
+
+    case MPC_TYPE_APPLY:      return mpc_first(p->data.apply.x, set, depth+1);
+    case MPC_TYPE_APPLY_TO:   return mpc_first(p->data.apply_to.x, set, depth+1);
+    case MPC_TYPE_CHECK:      return mpc_first(p->data.check.x, set, depth+1);
+    case MPC_TYPE_CHECK_WITH: return mpc_first(p->data.check_with.x, set, depth+1);
+    case MPC_TYPE_EXPECT:     return mpc_first(p->data.expect.x, set, depth+1);
+    case MPC_TYPE_PREDICT:    return mpc_first(p->data.predict.x, set, depth+1);
+    case MPC_TYPE_MANY1:      return mpc_first(p->data.repeat.x, set, depth+1);
+
+    case MPC_TYPE_MAYBE:
+      mpc_first(p->data.not.x, set, depth+1);
+      return 1;
+
+    case MPC_TYPE_MANY:
+      mpc_first(p->data.repeat.x, set, depth+1);
+      return 1;
+
+    case MPC_TYPE_COUNT:
+      return mpc_first(p->data.repeat.x, set, depth+1) || p->data.repeat.n == 0;
+
+    case MPC_TYPE_OR:
+      empty = p->data.or.n == 0;
+      for (i = 0; i < p->data.or.n; i++) {
+        empty = mpc_first(p->data.or.xs[i], set, depth+1) || empty;
+      }
+      return empty;
+
+    case MPC_TYPE_AND:
+      for (i = 0; i < p->data.and.n; i++) {
+        if (!mpc_first(p->data.and.xs[i], set, depth+1)) { return 0; }
+      }
+      return 1;
+
+    /* Anchors, lifts, state and not consume nothing */
+    default: return 1;
+  }
+
+}
+
+/*
+** Regex Compilation
+**
+** A regex that is a sequence of character classes,
+** each optionally repeated, is compiled to a table
+** giving the next state for every state and
+** character. Repeats never give back what they
+** matched, so each step depends only on the next
+** character and the table matches exactly what
+** the regex would. Other regexes are left as is.
+*/
+
+enum {
+  MPC_DFA_ELEMS = 64
+};
+
+typedef struct {
+  unsigned char set[32];
+  int min;
+  int max;
+} mpc_dfa_elem_t;
+
+/* The highest count kept for an element */
+static int mpc_dfa_cap(const mpc_dfa_elem_t *x) {
+  return x->max >= 0 ? x->max : x->min;
+}
+
+/* A class is a single character parser, or a choice of them */
+static int mpc_dfa_class(mpc_parser_t *p, unsigned char *set) {
+  int i;
+  switch (p->type) {
+    case MPC_TYPE_EXPECT: return mpc_dfa_class(p->data.expect.x, set);
+    case MPC_TYPE_OR:
+      for (i = 0; i < p->data.or.n; i++) {
+        if (!mpc_dfa_class(p->data.or.xs[i], set)) { return 0; }
+      }
+      return p->data.or.n > 0;
+    default: return mpc_first_class(p, set);
+  }
+}
+
+/* Gives how many times an element matches its class, with a max of -1 for no limit. A count of none still runs its parser once, so is left as is. */
+static int mpc_dfa_elem(mpc_parser_t *p, mpc_dfa_elem_t *x) {
+
+  memset(x->set, 0, sizeof(x->set));
+
+  switch (p->type) {
+    case MPC_TYPE_MAYBE:
+      x->min = 0; x->max = 1;
+      return p->data.not.lf == mpcf_ctor_str && mpc_dfa_class(p->data.not.x, x->set);
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      x->min = p->type == MPC_TYPE_MANY ? 0 : p->type == MPC_TYPE_MANY1 ? 1 : p->data.repeat.n;
+      x->max = p->type == MPC_TYPE_COUNT ? p->data.repeat.n : -1;
+      return p->data.repeat.f == mpcf_strfold && x->max != 0 && mpc_dfa_class(p->data.repeat.x, x->set);
+    default:
+      x->min = 1; x->max = 1;
+      return mpc_dfa_class(p, x->set);
+  }
+
+}
+
+/*
+** There is a state for each element and count of
+** times it has matched so far, counting no higher
+** than its min when it has no max, and one more
+** state for having matched every element.
+*/
+
+static mpc_parser_t *mpc_re_compile(mpc_parser_t *p) {
+
+  mpc_dfa_elem_t es[MPC_DFA_ELEMS];
+  int base[MPC_DFA_ELEMS + 1];
+  int i, j, n = 0, xs_num = 1, states, e, k, c, t;
+  mpc_parser_t **xs = &p, *d;
+  unsigned char *next, *accept;
+
+  if (p->type == MPC_TYPE_AND) {
+    if (p->data.and.f != mpcf_strfold) { return p; }
+    xs = p->data.and.xs;
+    xs_num = p->data.and.n;
+  }
+
+  for (i = 0; i < xs_num; i++) {
+    if (xs[i]->type == MPC_TYPE_LIFT && xs[i]->data.lift.lf == mpcf_ctor_str) { continue; }
+    if (xs[i]->retained || n == MPC_DFA_ELEMS || !mpc_dfa_elem(xs[i], &es[n])) { return p; }
+    n++;
+  }
+  if (n == 0) { return p; }
+
+  states = 0;
+  for (i = 0; i < n; i++) {
+    base[i] = states;
+    states += mpc_dfa_cap(&es[i]) + 1;
+    if (states >= MPC_DFA_STOP) { return p; }
+  }
+  base[n] = states++;
+
+  next = malloc(states * 256);
+  accept = malloc(states);
+
+  for (i = 0; i < n; i++) {
+    for (j = 0; j <= mpc_dfa_cap(&es[i]); j++) {
+
+      accept[base[i] + j] = j >= es[i].min;
+      for (e = i + 1; e < n; e++) { accept[base[i] + j] &= es[e].min == 0; }
+
+      /* A character is matched by this element if it can take it, else by the ones after */
+      for (c = 0; c < 256; c++) {
+        t = MPC_DFA_STOP;
+        for (e = i, k = j; e < n; e++, k = 0) {
+          if (mpc_first_has(es[e].set, c) && (es[e].max < 0 || k < es[e].max)) {
+            t = base[e] + (k < mpc_dfa_cap(&es[e]) ? k + 1 : k);
+            break;
+          }
+          if (k < es[e].min) { break; }
+        }
+        next[(base[i] + j) * 256 + c] = t;
+      }
+
+    }
+  }
+
+  memset(next + base[n] * 256, MPC_DFA_STOP, 256);
+  accept[base[n]] = 1;
+
+  d = mpc_undefined();
+  d->type = MPC_TYPE_DFA;
+  d->data.dfa.x = p;
+  d->data.dfa.n = states;
+  d->data.dfa.next = next;
+  d->data.dfa.accept = accept;
+  return d;
+}
+
+/*
+** Dispatch Tables
+**
+** An `or` whose alternatives all have to consume
+** input gets a table giving, for each character,
+** the alternatives that can start with it, in
+** order and ended by MPC_DISPATCH_END.
+*/
+
+static void mpc_dispatch_build(mpc_parser_t *p) {
+
+  int j, k, n = p->data.or.n;
+  unsigned char *sets, *row;
+
+  if (p->data.or.dispatch || n == 0 || n >= MPC_DISPATCH_END) { return; }
+
+  sets = calloc(n, 32);
+  for (j = 0; j < n; j++) {
+    if (mpc_first(p->data.or.xs[j], sets + j * 32, 0)) { free(sets); return; }
+  }
+
+  /* Zeroed, so that the unused end of each row is the same whenever it is written out */
+  p->data.or.dispatch = calloc(256, n + 1);
+  for (k = 0; k < 256; k++) {
+    row = p->data.or.dispatch + k * (n + 1);
+    for (j = 0; j < n; j++) {
+      if (mpc_first_has(sets + j * 32, k)) { *row++ = j; }
+    }
+    *row = MPC_DISPATCH_END;
+  }
+
+  free(sets);
+}
+
+static void mpc_dispatch_unretained(mpc_parser_t *p, int force) {
+
+  int i;
+
+  if (p->retained && !force) { return; }
+
+  switch (p->type) {
+    case MPC_TYPE_EXPECT:     mpc_dispatch_unretained(p->data.expect.x, 0); break;
+    case MPC_TYPE_APPLY:      mpc_dispatch_unretained(p->data.apply.x, 0); break;
+    case MPC_TYPE_APPLY_TO:   mpc_dispatch_unretained(p->data.apply_to.x, 0); break;
+    case MPC_TYPE_CHECK:      mpc_dispatch_unretained(p->data.check.x, 0); break;
+    case MPC_TYPE_CHECK_WITH: mpc_dispatch_unretained(p->data.check_with.x, 0); break;
+    case MPC_TYPE_PREDICT:    mpc_dispatch_unretained(p->data.predict.x, 0); break;
+    case MPC_TYPE_DFA:        mpc_dispatch_unretained(p->data.dfa.x, 0); break;
+    case MPC_TYPE_NOT:
+    case MPC_TYPE_MAYBE:      mpc_dispatch_unretained(p->data.not.x, 0); break;
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:      mpc_dispatch_unretained(p->data.repeat.x, 0); break;
+    case MPC_TYPE_OR:
+      for (i = 0; i < p->data.or.n; i++) { mpc_dispatch_unretained(p->data.or.xs[i], 0); }
+      mpc_dispatch_build(p);
+      break;
+    case MPC_TYPE_AND:
+      for (i = 0; i < p->data.and.n; i++) { mpc_dispatch_unretained(p->data.and.xs[i], 0); }
+      break;
+    default: break;
+  }
+
+}
+
 void mpc_optimise(mpc_parser_t *p) {
   mpc_optimise_unretained(p, 1);
+  mpc_dispatch_unretained(p, 1);
+}
+
+/*
+** Reports every `or` reachable from a parser with
+** alternatives that can start with the same
+** character, as those are the ones a dispatch
+** table cannot tell apart.
+*/
+
+static void mpc_overlaps_print(FILE *f, const unsigned char *set) {
+
+  int c, d, first = 1;
+
+  for (c = 1; c < 256; c++) {
+    if (!mpc_first_has(set, c)) { continue; }
+    for (d = c; d + 1 < 256 && mpc_first_has(set, d + 1); d++);
+    fprintf(f, first ? " " : ", ");
+    if (isprint(c)) { fprintf(f, "'%c'", c); } else { fprintf(f, "0x%02x", c); }
+    if (d > c) {
+      if (isprint(d)) { fprintf(f, "-'%c'", d); } else { fprintf(f, "-0x%02x", d); }
+    }
+    first = 0;
+    c = d;
+  }
+}
+
+static int mpc_overlaps_run(mpc_parser_t *p, const char *rule, FILE *f, mpc_parser_t ***seen, int *seen_num) {
+
+  int i, j, k, overlaps = 0;
+  unsigned char a[32], b[32], both[32];
+
+  if (p->retained) {
+    for (i = 0; i < *seen_num; i++) { if ((*seen)[i] == p) { return 0; } }
+    *seen = realloc(*seen, sizeof(mpc_parser_t*) * (*seen_num + 1));
+    (*seen)[(*seen_num)++] = p;
+    if (p->name) { rule = p->name; }
+  }
+
+  switch (p->type) {
+    case MPC_TYPE_EXPECT:     return mpc_overlaps_run(p->data.expect.x, rule, f, seen, seen_num);
+    case MPC_TYPE_APPLY:      return mpc_overlaps_run(p->data.apply.x, rule, f, seen, seen_num);
+    case MPC_TYPE_APPLY_TO:   return mpc_overlaps_run(p->data.apply_to.x, rule, f, seen, seen_num);
+    case MPC_TYPE_CHECK:      return mpc_overlaps_run(p->data.check.x, rule, f, seen, seen_num);
+    case MPC_TYPE_CHECK_WITH: return mpc_overlaps_run(p->data.check_with.x, rule, f, seen, seen_num);
+    case MPC_TYPE_PREDICT:    return mpc_overlaps_run(p->data.predict.x, rule, f, seen, seen_num);
+    case MPC_TYPE_DFA:        return mpc_overlaps_run(p->data.dfa.x, rule, f, seen, seen_num);
+    case MPC_TYPE_NOT:
+    case MPC_TYPE_MAYBE:      return mpc_overlaps_run(p->data.not.x, rule, f, seen, seen_num);
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:      return mpc_overlaps_run(p->data.repeat.x, rule, f, seen, seen_num);
+
+    case MPC_TYPE_AND:
+      for (i = 0; i < p->data.and.n; i++) {
+        overlaps += mpc_overlaps_run(p->data.and.xs[i], rule, f, seen, seen_num);
+      }
+      return overlaps;
+
+    case MPC_TYPE_OR:
+      for (i = 0; i < p->data.or.n; i++) {
+        memset(a, 0, sizeof(a));
+        mpc_first(p->data.or.xs[i], a, 0);
+        for (j = i + 1; j < p->data.or.n; j++) {
+          memset(b, 0, sizeof(b));
+          mpc_first(p->data.or.xs[j], b, 0);
+          for (k = 0; k < 32; k++) { both[k] = a[k] & b[k]; }
+          for (k = 0; k < 32 && !both[k]; k++);
+          if (k == 32) { continue; }
+          fprintf(f, "%s: alternatives %i and %i can both start with", rule ? rule : "<anonymous>", i + 1, j + 1);
+          mpc_overlaps_print(f, both);
+          fprintf(f, "\n");
+          overlaps++;
+        }
+      }
+      for (i = 0; i < p->data.or.n; i++) {
+        overlaps += mpc_overlaps_run(p->data.or.xs[i], rule, f, seen, seen_num);
+      }
+      return overlaps;
+
+    default: return 0;
+  }
+
+}
+
+int mpc_overlaps(mpc_parser_t *p, FILE *f) {
+  int seen_num = 0, overlaps;
+  mpc_parser_t **seen = NULL;
+  overlaps = mpc_overlaps_run(p, NULL, f, &seen, &seen_num);
+  free(seen);
+  return overlaps;
 }
 
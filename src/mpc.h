@@ -97,6 +97,15 @@ mpc_parser_t *mpc_undefine(mpc_parser_t *p);
 void mpc_delete(mpc_parser_t *p);
 void mpc_cleanup(int n, ...);
 
+/*
+** Packrat parsing remembers the result of each rule
+** at each position. Remembered results are copied and
+** freed as ASTs, so only rules defined by mpca_lang
+** are remembered, and enabling it on any other parser
+** is refused, returning 0.
+*/
+int mpc_packrat(mpc_parser_t *p, int enable);
+
 /*
 ** Basic Parsers
 */
@@ -281,12 +290,26 @@ mpc_parser_t *mpc_re_mode(const char *re, int mode);
 ** AST
 */
 
+/*
+** Besides its tag, a node records which grammar
+** rules it was parsed by as a set of rule ids, as
+** given by mpc_rule_id to rules defined with
+** mpca_lang, so it can be classified without
+** searching the tag. mpca_lang rejects a language
+** of more than MPC_AST_RULES rules.
+*/
+
+enum {
+  MPC_AST_RULES = 128
+};
+
 typedef struct mpc_ast_t {
   char *tag;
   char *contents;
   mpc_state_t state;
   int children_num;
   struct mpc_ast_t** children;
+  unsigned char rules[MPC_AST_RULES / 8];
 } mpc_ast_t;
 
 mpc_ast_t *mpc_ast_new(const char *tag, const char *contents);
@@ -296,6 +319,9 @@ mpc_ast_t *mpc_ast_add_child(mpc_ast_t *r, mpc_ast_t *a);
 mpc_ast_t *mpc_ast_add_tag(mpc_ast_t *a, const char *t);
 mpc_ast_t *mpc_ast_add_root_tag(mpc_ast_t *a, const char *t);
 mpc_ast_t *mpc_ast_tag(mpc_ast_t *a, const char *t);
+mpc_ast_t *mpc_ast_add_rule(mpc_ast_t *a, int id);
+int mpc_ast_has_rule(mpc_ast_t *a, int id);
+int mpc_rule_id(mpc_parser_t *p);
 mpc_ast_t *mpc_ast_state(mpc_ast_t *a, mpc_state_t s);
 
 void mpc_ast_delete(mpc_ast_t *a);
@@ -364,6 +390,9 @@ mpc_err_t *mpca_lang_file(int flags, FILE *f, ...);
 mpc_err_t *mpca_lang_pipe(int flags, FILE *f, ...);
 mpc_err_t *mpca_lang_contents(int flags, const char *filename, ...);
 
+mpc_err_t *mpca_tables_write(FILE *f, const char *name, int n, ...);
+mpc_err_t *mpca_tables(const unsigned char *tables, size_t len, int n, ...);
+
 /*
 ** Misc
 */
@@ -371,6 +400,7 @@ mpc_err_t *mpca_lang_contents(int flags, const char *filename, ...);
 
 void mpc_print(mpc_parser_t *p);
 void mpc_optimise(mpc_parser_t *p);
+int mpc_overlaps(mpc_parser_t *p, FILE *f);
 void mpc_stats(mpc_parser_t *p);
 
 int mpc_test_pass(mpc_parser_t *p, const char *s, const void *d,
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pool.h"
+#include "builtin.h"
+#include "cache.h"
+#include "server.h"
+
+/*
+ * Sandbox pool, used by `main --serve PATH --sandbox N`. Once the interpreter has loaded
+ * everything, workers are forked from it. Each inherits the global environment as it
+ * stands, copy on write, so starting one costs a fork rather than loading the prelude
+ * again. A worker waits for one job, a frame of source like a server request, evaluates
+ * it in its copy of the globals, writes the response frame back and exits. Nothing a
+ * job does can reach the interpreter or other jobs, and a job that crashes only takes
+ * its own worker down. Each finished worker is replaced by a fresh fork, so the pool
+ * stays full and the interpreter it is forked from never evaluates a job itself.
+ *
+ * Workers are separate processes, so a pool as large as the number of cores evaluates
+ * that many jobs at once.
+ *
+ * A slot whose fork fails is left empty and forked again by lpool_respawn, waiting
+ * twice as long after each failure in a row, so the pool fills up again once the
+ * system has room without retrying in a tight loop.
+ */
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <dirent.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#define LPOOL_FORK 1
+#else
+#define LPOOL_FORK 0
+#endif
+
+#if LPOOL_FORK
+
+// Wait before forking into a slot again after a failure, in milliseconds, doubling
+// from the first up to the second
+#define LPOOL_BACKOFF_MIN 10
+#define LPOOL_BACKOFF_MAX 1000
+
+static double lpool_now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int lpool_read_all(int fd, void* buf, size_t n) {
+  for (size_t got = 0; got < n;) {
+    ssize_t r = read(fd, (char*)buf + got, n - got);
+    if (r < 0 && errno == EINTR) { continue; }
+    if (r <= 0) { return 0; }
+    got += r;
+  }
+  return 1;
+}
+
+static int lpool_write_all(int fd, const void* buf, size_t n) {
+  for (size_t put = 0; put < n;) {
+    ssize_t r = write(fd, (const char*)buf + put, n - put);
+    if (r < 0 && errno == EINTR) { continue; }
+    if (r < 0) { return 0; }
+    put += r;
+  }
+  return 1;
+}
+
+// Closes every descriptor a worker inherited besides the standard ones and its pipes,
+// so that sockets and pipes the parent closes are not kept open by workers
+static void lworker_close_fds(int job, int result) {
+  DIR* d = opendir("/proc/self/fd");
+  if (!d) { return; }
+  for (struct dirent* de; (de = readdir(d));) {
+    int fd = atoi(de->d_name);
+    if (fd > 2 && fd != job && fd != result && fd != dirfd(d)) { close(fd); }
+  }
+  closedir(d);
+}
+
+// Body of a worker: evaluates one job and exits
+static void lworker_run(lisp_vm* vm, int job, int result) {
+  unsigned char len[4];
+  if (!lpool_read_all(job, len, 4)) { _exit(0); }
+  size_t n = len[0] | len[1] << 8 | len[2] << 16 | (size_t)len[3] << 24;
+  char* src = malloc(n ? n : 1);
+  if (!lpool_read_all(job, src, n)) { _exit(0); }
+
+  lval* x = lval_eval_all(vm, vm->env, lval_read_all(vm, "<request>", src, n));
+  lbuf b = {0};
+  lval_frame(&b, x);
+
+  // Anything printed goes out before the response, which the worker may be killed after
+  fflush(stdout);
+  fflush(stderr);
+  lpool_write_all(result, b.data, b.len);
+  _exit(0);
+}
+
+// Forks a worker into a slot of the pool
+static void lworker_new(lpool* p, lworker* w) {
+  int job[2], result[2];
+  w->pid = -1;
+  w->busy = 0;
+  w->data = NULL;
+  if (pipe(job) < 0) { w->job = w->result = -1; return; }
+  if (pipe(result) < 0) {
+    close(job[0]); close(job[1]);
+    w->job = w->result = -1;
+    return;
+  }
+
+  // Nothing buffered may be written twice, once by the worker as well
+  fflush(stdout);
+  fflush(stderr);
+
+  pid_t parent = getpid();
+  pid_t pid = fork();
+  if (pid == 0) {
+    // Workers go when the interpreter they were forked from does
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+    if (getppid() != parent) { _exit(0); }
+
+    sigset_t none;
+    sigemptyset(&none);
+    sigprocmask(SIG_SETMASK, &none, NULL);
+    signal(SIGPIPE, SIG_DFL);
+
+    lworker_close_fds(job[0], result[1]);
+    lworker_run(p->vm, job[0], result[1]);
+  }
+
+  close(job[0]);
+  close(result[1]);
+  if (pid < 0) {
+    close(job[1]); close(result[0]);
+    w->job = w->result = -1;
+    return;
+  }
+  fcntl(job[1], F_SETFD, FD_CLOEXEC);
+  fcntl(result[0], F_SETFD, FD_CLOEXEC);
+  fcntl(result[0], F_SETFL, O_NONBLOCK);
+  w->pid = pid;
+  w->job = job[1];
+  w->result = result[0];
+}
+
+// Forks a worker into a slot, or sets when to try again if it cannot
+static void lworker_spawn(lpool* p, lworker* w) {
+  lworker_new(p, w);
+  if (w->pid > 0) {
+    w->failures = 0;
+    return;
+  }
+  double wait = LPOOL_BACKOFF_MIN;
+  for (int i = 0; i < w->failures && wait < LPOOL_BACKOFF_MAX; i++) { wait *= 2; }
+  w->retry = lpool_now() + (wait < LPOOL_BACKOFF_MAX ? wait : LPOOL_BACKOFF_MAX);
+  w->failures++;
+}
+
+// Forks a pool of workers from an interpreter, 0 being one per core
+lpool* lpool_new(lisp_vm* vm, int size) {
+  if (size <= 0) { size = sysconf(_SC_NPROCESSORS_ONLN); }
+  if (size <= 0) { size = 1; }
+
+  // A job written to a worker that has died fails instead of stopping the interpreter
+  signal(SIGPIPE, SIG_IGN);
+
+  lpool* p = malloc(sizeof(lpool));
+  p->vm = vm;
+  p->size = size;
+  p->workers = calloc(size, sizeof(lworker));
+  for (int i = 0; i < size; i++) { lworker_spawn(p, &p->workers[i]); }
+  return p;
+}
+
+static void lworker_del(lworker* w) {
+  if (w->pid > 0) {
+    kill(w->pid, SIGKILL);
+    waitpid(w->pid, NULL, 0);
+  }
+  if (w->job >= 0) { close(w->job); }
+  if (w->result >= 0) { close(w->result); }
+}
+
+// Kills and reaps every worker
+void lpool_del(lpool* p) {
+  for (int i = 0; i < p->size; i++) { lworker_del(&p->workers[i]); }
+  free(p->workers);
+  free(p);
+}
+
+// Gives a worker with no job yet, or NULL if all are busy
+lworker* lpool_take(lpool* p) {
+  for (int i = 0; i < p->size; i++) {
+    lworker* w = &p->workers[i];
+    if (!w->busy && w->pid > 0) {
+      w->busy = 1;
+      return w;
+    }
+  }
+  return NULL;
+}
+
+// Hands a worker its job. Returns 0 if the worker has died, in which case its result
+// pipe is closed without a response.
+int lpool_send(lworker* w, const char* src, size_t len) {
+  unsigned char n[4] = { len, len >> 8, len >> 16, len >> 24 };
+  return lpool_write_all(w->job, n, 4) && lpool_write_all(w->job, src, len);
+}
+
+// Replaces a worker that has responded or died with a fresh one
+void lpool_recycle(lpool* p, lworker* w) {
+  lworker_del(w);
+  lworker_spawn(p, w);
+}
+
+// Forks a worker again into a slot where forking failed, once it has waited long
+// enough. Returns 0 if the slot has a worker, or else how many milliseconds are left
+// before it should be tried again.
+int lpool_respawn(lpool* p, lworker* w) {
+  if (w->pid > 0) { return 0; }
+  if (lpool_now() >= w->retry) { lworker_spawn(p, w); }
+  if (w->pid > 0) { return 0; }
+  double left = w->retry - lpool_now();
+  return left > 0 ? (int)left + 1 : 1;
+}
+
+// Counts the slots that have a worker, busy or not
+int lpool_running(lpool* p) {
+  int n = 0;
+  for (int i = 0; i < p->size; i++) { n += p->workers[i].pid > 0; }
+  return n;
+}
+
+#else
+
+lpool* lpool_new(lisp_vm* vm, int size) { return NULL; }
+void lpool_del(lpool* p) {}
+lworker* lpool_take(lpool* p) { return NULL; }
+int lpool_send(lworker* w, const char* src, size_t len) { return 0; }
+void lpool_recycle(lpool* p, lworker* w) {}
+int lpool_respawn(lpool* p, lworker* w) { return 0; }
+int lpool_running(lpool* p) { return 0; }
+
+#endif
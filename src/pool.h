@@ -0,0 +1,42 @@
+#ifndef pool_h
+#define pool_h
+
+#include <sys/types.h>
+
+#include "vm.h"
+
+// A process forked from an interpreter, waiting to evaluate one job
+typedef struct {
+  pid_t pid;
+
+  // Pipes the job is written to and its response is read back from
+  int job;
+  int result;
+
+  // Set by lpool_take until the worker is recycled, along with whatever the caller
+  // keeps for its job
+  int busy;
+  void* data;
+
+  // Forks that have failed in a row for this slot, and when to try again, in
+  // milliseconds on the monotonic clock
+  int failures;
+  double retry;
+} lworker;
+
+// Workers forked ahead of time from an interpreter that has been set up once
+typedef struct {
+  lisp_vm* vm;
+  int size;
+  lworker* workers;
+} lpool;
+
+lpool* lpool_new(lisp_vm* vm, int size);
+void lpool_del(lpool* p);
+lworker* lpool_take(lpool* p);
+int lpool_send(lworker* w, const char* src, size_t len);
+void lpool_recycle(lpool* p, lworker* w);
+int lpool_respawn(lpool* p, lworker* w);
+int lpool_running(lpool* p);
+
+#endif
@@ -0,0 +1,613 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "reader.h"
+
+/*
+ * Reader that turns source text straight into lvals, accepting exactly what the mpc
+ * grammar in grammar.c does without building an mpc_ast_t first. Nesting is tracked on
+ * an explicit stack, so deeply nested input cannot overflow the C stack, and errors give
+ * the line and column they were found at.
+ *
+ * Setting LISPERERS_MPC in the environment goes back to reading through mpc.
+ *
+ * Bytes are classified 64 at a time into bit masks, as in simdjson's structural index,
+ * and the reader steps over whole runs of whitespace, digits, symbol characters, string
+ * contents and comments by finding the first bit that ends them. The masks are built
+ * with AVX2 or SSE2 on x86-64, picked when the first reader starts, and a byte at a time
+ * elsewhere.
+ */
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define LREAD_SIMD 1
+#else
+#define LREAD_SIMD 0
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#define LREAD_THREADS 1
+#else
+#define LREAD_THREADS 0
+#endif
+
+// Characters allowed in a symbol
+int lread_symchar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+    || strchr("_+-*/\\=<>!&", c) != NULL;
+}
+
+int lread_digit(char c) { return c >= '0' && c <= '9'; }
+
+// Classes of each byte, for building masks a byte at a time
+unsigned char lread_table[256];
+
+void lread_classify_bytes(const char* s, uint64_t* bits) {
+  for (int i = 0; i < 64; i++) {
+    int k = lread_table[(unsigned char)s[i]];
+    for (int c = 0; c < LREAD_CLASSES; c++) {
+      if (k & (1 << c)) { bits[c] |= (uint64_t)1 << i; }
+    }
+  }
+}
+
+#if LREAD_SIMD
+
+// Symbols take NUL bytes too, as strchr finds them in lread_symchar
+void lread_classify_sse2(const char* s, uint64_t* bits) {
+  #define LREAD_EQ(x, v) _mm_cmpeq_epi8(x, _mm_set1_epi8(v))
+  #define LREAD_IN(x, lo, hi) _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8((lo) - 1)), \
+    _mm_cmpgt_epi8(_mm_set1_epi8((hi) + 1), x))
+  for (int i = 0; i < 64; i += 16) {
+    __m128i c = _mm_loadu_si128((const __m128i*)(s + i));
+    __m128i digit = LREAD_IN(c, '0', '9');
+    __m128i slash = LREAD_EQ(c, '\\');
+    __m128i sym = _mm_or_si128(_mm_or_si128(digit, LREAD_IN(_mm_or_si128(c, _mm_set1_epi8(0x20)), 'a', 'z')),
+      _mm_or_si128(_mm_or_si128(LREAD_EQ(c, '_'), LREAD_IN(c, '*', '+')),
+      _mm_or_si128(_mm_or_si128(LREAD_EQ(c, '-'), LREAD_EQ(c, '/')),
+      _mm_or_si128(_mm_or_si128(slash, LREAD_IN(c, '<', '>')),
+      _mm_or_si128(_mm_or_si128(LREAD_EQ(c, '!'), LREAD_EQ(c, '&')), LREAD_EQ(c, 0))))));
+    bits[LREAD_SPACE] |= (uint64_t)(unsigned)_mm_movemask_epi8(
+      _mm_or_si128(LREAD_EQ(c, ' '), LREAD_IN(c, '\t', '\r'))) << i;
+    bits[LREAD_SYMBOL] |= (uint64_t)(unsigned)_mm_movemask_epi8(sym) << i;
+    bits[LREAD_DIGIT] |= (uint64_t)(unsigned)_mm_movemask_epi8(digit) << i;
+    bits[LREAD_LINE_END] |= (uint64_t)(unsigned)_mm_movemask_epi8(
+      _mm_or_si128(LREAD_EQ(c, '\n'), LREAD_EQ(c, '\r'))) << i;
+    bits[LREAD_QUOTE] |= (uint64_t)(unsigned)_mm_movemask_epi8(
+      _mm_or_si128(slash, LREAD_EQ(c, '"'))) << i;
+  }
+  #undef LREAD_EQ
+  #undef LREAD_IN
+}
+
+__attribute__((target("avx2")))
+void lread_classify_avx2(const char* s, uint64_t* bits) {
+  #define LREAD_EQ(x, v) _mm256_cmpeq_epi8(x, _mm256_set1_epi8(v))
+  #define LREAD_IN(x, lo, hi) _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8((lo) - 1)), \
+    _mm256_cmpgt_epi8(_mm256_set1_epi8((hi) + 1), x))
+  for (int i = 0; i < 64; i += 32) {
+    __m256i c = _mm256_loadu_si256((const __m256i*)(s + i));
+    __m256i digit = LREAD_IN(c, '0', '9');
+    __m256i slash = LREAD_EQ(c, '\\');
+    __m256i sym = _mm256_or_si256(_mm256_or_si256(digit, LREAD_IN(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), 'a', 'z')),
+      _mm256_or_si256(_mm256_or_si256(LREAD_EQ(c, '_'), LREAD_IN(c, '*', '+')),
+      _mm256_or_si256(_mm256_or_si256(LREAD_EQ(c, '-'), LREAD_EQ(c, '/')),
+      _mm256_or_si256(_mm256_or_si256(slash, LREAD_IN(c, '<', '>')),
+      _mm256_or_si256(_mm256_or_si256(LREAD_EQ(c, '!'), LREAD_EQ(c, '&')), LREAD_EQ(c, 0))))));
+    bits[LREAD_SPACE] |= (uint64_t)(unsigned)_mm256_movemask_epi8(
+      _mm256_or_si256(LREAD_EQ(c, ' '), LREAD_IN(c, '\t', '\r'))) << i;
+    bits[LREAD_SYMBOL] |= (uint64_t)(unsigned)_mm256_movemask_epi8(sym) << i;
+    bits[LREAD_DIGIT] |= (uint64_t)(unsigned)_mm256_movemask_epi8(digit) << i;
+    bits[LREAD_LINE_END] |= (uint64_t)(unsigned)_mm256_movemask_epi8(
+      _mm256_or_si256(LREAD_EQ(c, '\n'), LREAD_EQ(c, '\r'))) << i;
+    bits[LREAD_QUOTE] |= (uint64_t)(unsigned)_mm256_movemask_epi8(
+      _mm256_or_si256(slash, LREAD_EQ(c, '"'))) << i;
+  }
+  #undef LREAD_EQ
+  #undef LREAD_IN
+}
+
+#endif
+
+void (*lread_classify)(const char* s, uint64_t* bits) = NULL;
+
+// Picks the widest way of building masks this CPU has
+void lread_pick(void) {
+  for (int c = 0; c < 256; c++) {
+    int k = 0;
+    if (c == ' ' || (c >= '\t' && c <= '\r')) { k |= 1 << LREAD_SPACE; }
+    if (lread_symchar((char)c)) { k |= 1 << LREAD_SYMBOL; }
+    if (lread_digit((char)c)) { k |= 1 << LREAD_DIGIT; }
+    if (c == '\n' || c == '\r') { k |= 1 << LREAD_LINE_END; }
+    if (c == '"' || c == '\\') { k |= 1 << LREAD_QUOTE; }
+    lread_table[c] = k;
+  }
+  lread_classify = lread_classify_bytes;
+#if LREAD_SIMD
+  lread_classify = __builtin_cpu_supports("avx2") ? lread_classify_avx2 : lread_classify_sse2;
+#endif
+}
+
+#if LREAD_THREADS
+pthread_once_t lread_picked = PTHREAD_ONCE_INIT;
+#endif
+
+// Picks the way of building masks before the first reader starts, once per process
+void lread_setup(void) {
+#if LREAD_THREADS
+  pthread_once(&lread_picked, lread_pick);
+#else
+  if (!lread_classify) { lread_pick(); }
+#endif
+}
+
+// Index of the lowest set bit of a mask that is not zero
+int lread_first(uint64_t m) {
+#ifdef __GNUC__
+  return __builtin_ctzll(m);
+#else
+  int i = 0;
+  while (!(m & 1)) { m >>= 1; i++; }
+  return i;
+#endif
+}
+
+// Builds the masks for the 64 bytes from `at`, padding the end of the source with zeros
+void lread_index(lread_pos* p, const char* at) {
+  char pad[64];
+  const char* b = at;
+  p->block = at;
+  p->block_len = p->end - at < 64 ? (int)(p->end - at) : 64;
+  if (p->block_len < 64) {
+    memset(pad, 0, sizeof(pad));
+    memcpy(pad, at, p->block_len);
+    b = pad;
+  }
+  memset(p->bits, 0, sizeof(p->bits));
+  lread_classify(b, p->bits);
+}
+
+// Gives the mask of a class for the bytes from `at`, which must be before the end of
+// the source, with the number of its bits that are source in `known`
+uint64_t lread_bits(lread_pos* p, const char* at, int class, int* known) {
+  if (!p->block || at < p->block || at >= p->block + p->block_len) { lread_index(p, at); }
+  int off = at - p->block;
+  *known = p->block_len - off;
+  return p->bits[class] >> off;
+}
+
+// Counts the bytes from `at` that are in a class, or with `in` unset that are not
+size_t lread_span(lread_pos* p, const char* at, int class, int in) {
+  size_t n = 0;
+  while (at + n < p->end) {
+    int known;
+    uint64_t m = lread_bits(p, at + n, class, &known);
+    if (in) { m = ~m; }
+    if (known < 64) { m &= ((uint64_t)1 << known) - 1; }
+    if (m) { return n + lread_first(m); }
+    n += known;
+  }
+  return n;
+}
+
+// Moves the cursor over n bytes that hold no newline
+void lread_skip(lread_pos* p, size_t n) {
+  p->s += n;
+  p->col += n;
+}
+
+// Moves the cursor over n bytes, counting the lines they end
+void lread_advance(lread_pos* p, size_t n) {
+  const char* end = p->s + n;
+  for (const char* q; (q = memchr(p->s, '\n', end - p->s)); p->s = q + 1) {
+    p->line++;
+    p->col = 1;
+  }
+  lread_skip(p, end - p->s);
+}
+
+// Makes an error naming where it happened, in the same form as mpc's errors
+lval* lread_err(const char* name, int line, int col, char* msg) {
+  return lval_err("%s:%i:%i: error: %s", name, line, col, msg);
+}
+
+// Reads the literal at the cursor: a number, symbol or string. Returns NULL, without
+// moving, at a string missing its closing quote.
+lval* lread_atom(lread_pos* p) {
+  const char* start = p->s;
+  size_t len;
+  lval* x;
+
+  // As in the grammar, a number is tried first and may be directly followed by a symbol
+  if (lread_digit(*p->s) || (*p->s == '-' && p->s + 1 < p->end && lread_digit(p->s[1]))) {
+    len = 1 + lread_span(p, start + 1, LREAD_DIGIT, 1);
+    char* tok = malloc(len + 1);
+    memcpy(tok, start, len);
+    tok[len] = '\0';
+    errno = 0;
+    long n = strtol(tok, NULL, 10);
+    x = errno != ERANGE ? lval_num(n) : lval_err("Invalid Number.");
+    free(tok);
+
+  } else if (*p->s == '"') {
+    // Runs of plain characters are skipped up to each quote or backslash
+    int escaped = 0;
+    len = 1;
+    while (1) {
+      len += lread_span(p, start + len, LREAD_QUOTE, 0);
+      if (start + len >= p->end) { return NULL; }
+      if (start[len] == '"') { break; }
+      len += start + len + 1 < p->end ? 2 : 1;
+      escaped = 1;
+    }
+    len++;
+
+    // Unescape what is between the quotes, as lval_read_str does, if there is anything
+    // to unescape
+    char* unescaped = malloc(len - 1);
+    memcpy(unescaped, start + 1, len - 2);
+    unescaped[len - 2] = '\0';
+    if (escaped) { unescaped = mpcf_unescape(unescaped); }
+    x = lval_str(unescaped);
+    free(unescaped);
+
+  } else {
+    len = lread_span(p, start, LREAD_SYMBOL, 1);
+    char* tok = malloc(len + 1);
+    memcpy(tok, start, len);
+    tok[len] = '\0';
+    x = lval_sym(tok);
+    free(tok);
+  }
+
+  if (*start == '"') { lread_advance(p, len); } else { lread_skip(p, len); }
+  return x;
+}
+
+void lread_init(lreader* r, const char* name, const char* src, size_t len) {
+  lread_setup();
+  r->p = (lread_pos){ name, src, src + len, 1, 1 };
+  r->depth = 0;
+  r->cap = 16;
+  r->stack = malloc(sizeof(lread_open) * r->cap);
+  r->failed = 0;
+  r->more = 0;
+  r->pool = NULL;
+}
+
+// Continues reading from new source, which must start with whatever was left unread of
+// the previous source and be fed a whole line at a time, so only strings can be split
+void lread_feed(lreader* r, const char* src, size_t len) {
+  r->p.s = src;
+  r->p.end = src + len;
+  r->p.block = NULL;
+}
+
+void lread_pool_free(struct lread_pool* q);
+
+// Frees the reader, along with any lists left open by an error
+void lread_free(lreader* r) {
+  if (r->pool) { lread_pool_free(r->pool); }
+  for (int i = 1; i <= r->depth; i++) { lval_del(r->stack[i].list); }
+  free(r->stack);
+}
+
+// Stops reading with an error at the current position
+lval* lread_fail(lreader* r, char* msg) {
+  r->failed = 1;
+  return lread_err(r->p.name, r->p.line, r->p.col, msg);
+}
+
+// Reads the next top level expression. Returns NULL at the end of the source, or an
+// error with `failed` set if the source is malformed, after which nothing more is read.
+lval* lread_pool_next(lreader* r);
+
+lval* lread_next(lreader* r) {
+  lread_pos* p = &r->p;
+  if (r->failed) { return NULL; }
+  if (r->pool) { return lread_pool_next(r); }
+
+  while (1) {
+    if (p->s >= p->end) {
+      if (r->depth == 0 || r->more) { return NULL; }
+      lread_open* o = &r->stack[r->depth];
+      char msg[64];
+      snprintf(msg, sizeof(msg), "expected '%c' to close list opened at %i:%i",
+        o->close, o->line, o->col);
+      return lread_fail(r, msg);
+    }
+
+    char c = *p->s;
+    lval* x;
+
+    // Whitespace and comments
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') {
+      lread_advance(p, lread_span(p, p->s, LREAD_SPACE, 1));
+      continue;
+    }
+    if (c == ';') {
+      lread_skip(p, lread_span(p, p->s, LREAD_LINE_END, 0));
+      continue;
+    }
+
+    // Opening a list pushes it, closing one pops it as a finished expression
+    if (c == '(' || c == '{') {
+      if (r->depth + 1 == r->cap) {
+        r->cap *= 2;
+        r->stack = realloc(r->stack, sizeof(lread_open) * r->cap);
+      }
+      r->depth++;
+      r->stack[r->depth] = (lread_open){ c == '(' ? lval_sexpr() : lval_qexpr(),
+        c == '(' ? ')' : '}', p->line, p->col };
+      lread_skip(p, 1);
+      continue;
+    }
+
+    if (c == ')' || c == '}') {
+      lread_open* o = &r->stack[r->depth];
+      if (r->depth == 0 || o->close != c) {
+        char msg[80];
+        if (r->depth == 0) {
+          snprintf(msg, sizeof(msg), "unexpected '%c'", c);
+        } else {
+          snprintf(msg, sizeof(msg), "expected '%c' to close list opened at %i:%i, got '%c'",
+            o->close, o->line, o->col, c);
+        }
+        return lread_fail(r, msg);
+      }
+      x = o->list;
+      r->depth--;
+      lread_skip(p, 1);
+
+    } else {
+      // Anything else must be a literal
+      if (!lread_symchar(c) && c != '"') {
+        char msg[64];
+        if (c > 32 && c < 127) {
+          snprintf(msg, sizeof(msg), "unexpected character '%c'", c);
+        } else {
+          snprintf(msg, sizeof(msg), "unexpected byte 0x%02x", (unsigned char)c);
+        }
+        return lread_fail(r, msg);
+      }
+      x = lread_atom(p);
+      if (!x && r->more) { return NULL; }
+      if (!x) { return lread_fail(r, "unterminated string"); }
+    }
+
+    // A finished expression either goes into the enclosing list or is handed out
+    if (r->depth == 0) { return x; }
+    lval_add(r->stack[r->depth].list, x);
+  }
+}
+
+// Reads every expression in some source, returning them in an S-Expression or an error
+lval* lval_read_src(const char* name, const char* src, size_t len) {
+  lreader r;
+  lread_init(&r, name, src, len);
+
+  lval* v = lval_sexpr();
+  lval* x;
+  while ((x = lread_next(&r))) {
+    if (r.failed) {
+      lval_del(v);
+      v = x;
+      break;
+    }
+    lval_add(v, x);
+  }
+
+  lread_free(&r);
+  return v;
+}
+
+/*
+ * Large sources are read in parallel. A quick scan, which only follows brackets, strings
+ * and comments, cuts the source at the starts of lines outside any expression. Threads
+ * then read the pieces in order, each into a vector of its expressions, while lread_next
+ * hands them out in order as each piece is finished, so they are still evaluated one at a
+ * time on the calling thread. Reading stops after a piece that turns out to be malformed.
+ */
+
+// Sources smaller than this are read on the calling thread
+#define LREAD_PARALLEL_MIN (1 << 20)
+
+// Pieces are at least this big, and there are a few per thread to even out the work
+#define LREAD_PIECE_MIN (1 << 18)
+#define LREAD_PIECES_PER_THREAD 4
+
+// A piece of source and the expressions read from it, the last of which is an error if
+// `failed` is set
+typedef struct {
+  const char* s;
+  size_t len;
+  int line;
+  lval** xs;
+  int count;
+  int next;
+  int failed;
+  int ready;
+} lread_piece;
+
+typedef struct lread_pool {
+  const char* name;
+  lread_piece* pieces;
+  int count;
+  int current;
+  int claimed;
+  int stopped;
+#if LREAD_THREADS
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+  pthread_t* threads;
+  int nthreads;
+#endif
+} lread_pool;
+
+// Cuts a source into at most `n` pieces of about the same size, at the starts of lines
+// that are outside any expression, string or comment. Returns the number of pieces.
+int lread_split(const char* s, size_t len, int n, lread_piece* pieces) {
+  size_t step = len / n;
+  size_t start = 0;
+  int depth = 0;
+  int line = 1;
+  int k = 0;
+  pieces[0] = (lread_piece){ s, 0, 1 };
+
+  for (size_t i = 0; i < len; i++) {
+    char c = s[i];
+    if (c == '"') {
+      for (i++; i < len && s[i] != '"'; i++) {
+        if (s[i] == '\\' && i + 1 < len) { i++; }
+        if (s[i] == '\n') { line++; }
+      }
+    } else if (c == ';') {
+      while (i + 1 < len && s[i + 1] != '\n' && s[i + 1] != '\r') { i++; }
+    } else if (c == '(' || c == '{') {
+      depth++;
+    } else if (c == ')' || c == '}') {
+      depth--;
+    } else if (c == '\n') {
+      line++;
+      if (depth == 0 && i + 1 - start >= step && i + 1 < len && k + 1 < n) {
+        pieces[k].len = i + 1 - start;
+        start = i + 1;
+        pieces[++k] = (lread_piece){ s + start, 0, line };
+      }
+    }
+  }
+
+  pieces[k].len = len - start;
+  return k + 1;
+}
+
+// Reads a piece into its vector of expressions
+void lread_piece_read(const char* name, lread_piece* c) {
+  lreader r;
+  lread_init(&r, name, c->s, c->len);
+  r.p.line = c->line;
+
+  int cap = 0;
+  for (lval* x; (x = lread_next(&r));) {
+    if (c->count == cap) {
+      cap = cap ? cap * 2 : 64;
+      c->xs = realloc(c->xs, sizeof(lval*) * cap);
+    }
+    c->xs[c->count++] = x;
+    if (r.failed) {
+      c->failed = 1;
+      break;
+    }
+  }
+  lread_free(&r);
+}
+
+#if LREAD_THREADS
+
+// Reads pieces in order until there are none left, or one has failed
+void* lread_pool_work(void* arg) {
+  lread_pool* q = arg;
+  while (1) {
+    pthread_mutex_lock(&q->lock);
+    int k = q->stopped ? q->count : q->claimed++;
+    pthread_mutex_unlock(&q->lock);
+    if (k >= q->count) { return NULL; }
+
+    lread_piece_read(q->name, &q->pieces[k]);
+
+    pthread_mutex_lock(&q->lock);
+    q->pieces[k].ready = 1;
+    if (q->pieces[k].failed) { q->stopped = 1; }
+    pthread_cond_broadcast(&q->ready);
+    pthread_mutex_unlock(&q->lock);
+  }
+}
+
+#endif
+
+// Starts a reader, reading the source in parallel if it is large enough to be worth it,
+// on the given number of threads or with 0 on one per core
+void lread_init_parallel(lreader* r, const char* name, const char* src, size_t len,
+  int threads) {
+  lread_init(r, name, src, len);
+
+#if LREAD_THREADS
+  if (threads <= 0) { threads = sysconf(_SC_NPROCESSORS_ONLN); }
+  if (len < LREAD_PARALLEL_MIN || threads < 2) { return; }
+
+  int n = threads * LREAD_PIECES_PER_THREAD;
+  if ((size_t)n > len / LREAD_PIECE_MIN) { n = len / LREAD_PIECE_MIN; }
+
+  lread_pool* q = calloc(1, sizeof(lread_pool));
+  q->name = name;
+  q->pieces = calloc(n, sizeof(lread_piece));
+  q->count = lread_split(src, len, n, q->pieces);
+  if (q->count < 2) {
+    free(q->pieces);
+    free(q);
+    return;
+  }
+
+  pthread_mutex_init(&q->lock, NULL);
+  pthread_cond_init(&q->ready, NULL);
+  if (threads > q->count) { threads = q->count; }
+  q->threads = malloc(sizeof(pthread_t) * threads);
+  while (q->nthreads < threads
+    && pthread_create(&q->threads[q->nthreads], NULL, lread_pool_work, q) == 0) {
+    q->nthreads++;
+  }
+
+  // Without any threads the source is simply read here
+  if (q->nthreads == 0) {
+    lread_pool_free(q);
+    return;
+  }
+  r->pool = q;
+#endif
+}
+
+// Hands out the next expression of the pieces, waiting for its piece to be read
+lval* lread_pool_next(lreader* r) {
+#if LREAD_THREADS
+  lread_pool* q = r->pool;
+  while (q->current < q->count) {
+    lread_piece* c = &q->pieces[q->current];
+    if (c->next == 0) {
+      pthread_mutex_lock(&q->lock);
+      while (!c->ready) { pthread_cond_wait(&q->ready, &q->lock); }
+      pthread_mutex_unlock(&q->lock);
+    }
+
+    if (c->next < c->count) {
+      lval* x = c->xs[c->next++];
+      if (c->failed && c->next == c->count) { r->failed = 1; }
+      return x;
+    }
+    q->current++;
+  }
+#endif
+  return NULL;
+}
+
+// Stops the threads and frees every expression that was not handed out
+void lread_pool_free(lread_pool* q) {
+#if LREAD_THREADS
+  pthread_mutex_lock(&q->lock);
+  q->stopped = 1;
+  pthread_mutex_unlock(&q->lock);
+  for (int i = 0; i < q->nthreads; i++) { pthread_join(q->threads[i], NULL); }
+  pthread_mutex_destroy(&q->lock);
+  pthread_cond_destroy(&q->ready);
+  free(q->threads);
+#endif
+
+  for (int k = 0; k < q->count; k++) {
+    lread_piece* c = &q->pieces[k];
+    for (int i = c->next; i < c->count; i++) { lval_del(c->xs[i]); }
+    free(c->xs);
+  }
+  free(q->pieces);
+  free(q);
+}
@@ -0,0 +1,62 @@
+#ifndef reader_h
+#define reader_h
+
+#include <stdint.h>
+
+#include "lval.h"
+
+// Classes of bytes the reader finds runs of
+enum {
+  LREAD_SPACE,
+  LREAD_SYMBOL,
+  LREAD_DIGIT,
+  LREAD_LINE_END,
+  LREAD_QUOTE,
+  LREAD_CLASSES
+};
+
+// A list still waiting for its closing bracket
+typedef struct {
+  lval* list;
+  char close;
+  int line;
+  int col;
+} lread_open;
+
+// Position within the source being read, along with the classes of the 64 bytes from
+// `block`, one bit per byte, of which the first `block_len` are source
+typedef struct {
+  const char* name;
+  const char* s;
+  const char* end;
+  int line;
+  int col;
+  const char* block;
+  int block_len;
+  uint64_t bits[LREAD_CLASSES];
+} lread_pos;
+
+struct lread_pool;
+
+// Reader handing out one top level expression at a time. With `more` set, running out
+// of source is not an error, as more is still to be fed in with lread_feed. With `pool`
+// set, the expressions come from pieces of the source read on other threads.
+typedef struct {
+  lread_pos p;
+  lread_open* stack;
+  int depth;
+  int cap;
+  int failed;
+  int more;
+  struct lread_pool* pool;
+} lreader;
+
+void lread_init(lreader* r, const char* name, const char* src, size_t len);
+void lread_init_parallel(lreader* r, const char* name, const char* src, size_t len,
+  int threads);
+void lread_feed(lreader* r, const char* src, size_t len);
+void lread_free(lreader* r);
+lval* lread_next(lreader* r);
+lval* lval_read_src(const char* name, const char* src, size_t len);
+
+#endif
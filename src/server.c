@@ -0,0 +1,537 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "server.h"
+#include "builtin.h"
+#include "cache.h"
+#include "pool.h"
+
+/*
+ * Evaluation server, started with `main --serve PATH`. It listens on a Unix domain
+ * socket and evaluates requests in the interpreter's global environment, which stays
+ * loaded from one request to the next. Requests and responses are frames: a 4 byte
+ * little-endian length, as in caches, then that many bytes. A request is source, and
+ * its response a status byte, 0 for a value or 1 for an error, followed by the printed
+ * value of the request's last expression or the message of its first error.
+ *
+ * Each connection evaluates in an environment of its own under the globals, so names
+ * bound with `=` only last as long as the connection, while `def` still changes the
+ * globals every connection sees. Clients may send several requests without waiting for
+ * the responses, which come back in order. Everything is evaluated on one thread driven
+ * by epoll, so a slow request holds up the others.
+ *
+ * With `--sandbox N`, requests are instead handed to a pool of N worker processes forked
+ * from the interpreter (see pool.c). Each request then starts from the globals as they
+ * were loaded and nothing it binds outlives it. Requests from one connection may be
+ * evaluated at once by different workers, but their responses still go back in order.
+ *
+ * The time taken to evaluate each request is kept in a histogram, printed to stderr on
+ * SIGUSR1 and when the server is stopped with SIGINT or SIGTERM.
+ */
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#define LSERVE_EPOLL 1
+#else
+#define LSERVE_EPOLL 0
+#endif
+
+#if LSERVE_EPOLL
+
+// Largest request accepted; a connection sending a bigger one is closed
+#define LSERVE_MAX_FRAME (16 << 20)
+// Requests are not evaluated while a connection has this much unsent
+#define LSERVE_MAX_PENDING (1 << 20)
+// Bytes read from a connection at a time
+#define LSERVE_READ (64 << 10)
+// Buckets of the latency histogram, each twice as wide as the last
+#define LSERVE_BUCKETS 32
+
+struct ljob;
+
+// A client connection
+typedef struct lconn {
+  int fd;
+  lenv* env;
+
+  // Bytes received and not yet evaluated, and responses not yet sent, from `sent` on
+  lbuf in;
+  lbuf out;
+  size_t sent;
+
+  // Requests handed to sandbox workers, oldest first
+  struct ljob* jobs;
+  struct ljob* last;
+
+  // Whether requests were held back until responses are sent or until a worker is free,
+  // whether the client has stopped sending, and the events being watched for
+  int held;
+  int waiting;
+  int eof;
+  unsigned int events;
+
+  // Closed connections are only freed once every event epoll returned with them is seen
+  int closed;
+  struct lconn* next_closed;
+} lconn;
+
+// A request being evaluated by a sandbox worker, and its response once it comes back
+typedef struct ljob {
+  lconn* c;
+  lbuf resp;
+  double start;
+  int done;
+  struct ljob* next;
+} ljob;
+
+// Latencies of the requests evaluated. Bucket 0 counts those under a microsecond, and
+// bucket i those under 2^i microseconds but not under 2^(i-1).
+typedef struct {
+  unsigned long count[LSERVE_BUCKETS];
+  unsigned long requests;
+  unsigned long errors;
+  double total;
+  double max;
+} lhist;
+
+// Everything a server keeps track of
+typedef struct {
+  lisp_vm* vm;
+  int ep;
+  lpool* pool;
+  lhist h;
+  int nconns;
+  int cap;
+  lconn** conns;
+  lconn* closed;
+} lserver;
+
+// Tags telling the listening socket and the signals apart from connections in epoll
+static char lserve_listener;
+static char lserve_signals;
+
+static double lserve_now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static void lhist_add(lhist* h, double us, int failed) {
+  int b = 0;
+  while (b < LSERVE_BUCKETS - 1 && us >= (double)(1UL << b)) { b++; }
+  h->count[b]++;
+  h->requests++;
+  h->errors += failed;
+  h->total += us;
+  if (us > h->max) { h->max = us; }
+}
+
+static void lhist_print(lhist* h) {
+  fprintf(stderr, "requests: %lu, errors: %lu, mean: %.1f us, max: %.1f us\n",
+    h->requests, h->errors, h->requests ? h->total / h->requests : 0.0, h->max);
+
+  int first = 0, last = LSERVE_BUCKETS - 1;
+  while (first < last && !h->count[first]) { first++; }
+  while (last > first && !h->count[last]) { last--; }
+
+  unsigned long seen = 0;
+  for (int b = first; b <= last && h->requests; b++) {
+    seen += h->count[b];
+    fprintf(stderr, "  < %10lu us %10lu %6.2f%%\n", 1UL << b, h->count[b],
+      100.0 * seen / h->requests);
+  }
+}
+
+// Appends the response frame for the result of a request
+void lval_frame(lbuf* out, lval* x) {
+  char* s = NULL;
+  size_t n = 0;
+  FILE* f = open_memstream(&s, &n);
+  if (x->type == LVAL_ERR) { fputs(x->err, f); } else { lval_fprint(f, x); }
+  fclose(f);
+
+  lbuf_put_u32(out, n + 1);
+  lbuf_put_u8(out, x->type == LVAL_ERR);
+  lbuf_put(out, s, n);
+  free(s);
+}
+
+// Watches a worker's result pipe
+static void lserve_watch(lserver* s, lworker* w) {
+  if (w->result < 0) { return; }
+  struct epoll_event ev = { .events = EPOLLIN, .data.ptr = w };
+  epoll_ctl(s->ep, EPOLL_CTL_ADD, w->result, &ev);
+}
+
+// Replaces a worker with a fresh one, watching the new one's result pipe
+static void lserve_replace(lserver* s, lworker* w) {
+  epoll_ctl(s->ep, EPOLL_CTL_DEL, w->result, NULL);
+  lpool_recycle(s->pool, w);
+  lserve_watch(s, w);
+}
+
+// Finishes a sandboxed request, with an error response if no worker gave it a response
+// with a status byte
+static void ljob_finish(lserver* s, ljob* j, const char* err) {
+  if (j->resp.len < 5) {
+    lval* x = lval_err("%s", err);
+    j->resp.len = 0;
+    lval_frame(&j->resp, x);
+    lval_del(x);
+  }
+  j->done = 1;
+  lhist_add(&s->h, lserve_now() - j->start, j->resp.data[4]);
+}
+
+// Queues the responses of the oldest sandboxed requests, as far as they have come back
+static void lconn_collect(lconn* c) {
+  while (c->jobs && c->jobs->done) {
+    ljob* j = c->jobs;
+    lbuf_put(&c->out, j->resp.data, j->resp.len);
+    c->jobs = j->next;
+    if (!c->jobs) { c->last = NULL; }
+    free(j->resp.data);
+    free(j);
+  }
+}
+
+// Evaluates the complete requests a connection has received in order, or hands them to
+// sandbox workers, until too much is waiting to be sent or no worker is free. Returns 0
+// if the client sent a request too big to accept.
+static int lconn_eval(lserver* s, lconn* c) {
+  size_t at = 0;
+  c->waiting = 0;
+  while (c->in.len - at >= 4 && c->out.len - c->sent < LSERVE_MAX_PENDING) {
+    unsigned char* p = (unsigned char*)c->in.data + at;
+    size_t n = p[0] | p[1] << 8 | p[2] << 16 | (size_t)p[3] << 24;
+    if (n > LSERVE_MAX_FRAME) { return 0; }
+    if (c->in.len - at - 4 < n) { break; }
+
+    if (s->pool) {
+      // Requests wait for a worker to be free, unless every slot is waiting to be
+      // forked again
+      lworker* w = lpool_take(s->pool);
+      if (!w && lpool_running(s->pool)) { c->waiting = 1; break; }
+
+      ljob* j = calloc(1, sizeof(ljob));
+      j->c = c;
+      j->start = lserve_now();
+      if (c->last) { c->last->next = j; } else { c->jobs = j; }
+      c->last = j;
+
+      // A worker that dies while evaluating is noticed when its result pipe closes. One
+      // that has died before it could be handed the request is replaced at once.
+      if (!w) {
+        ljob_finish(s, j, "No sandbox worker is running");
+      } else if (!lpool_send(w, (char*)p + 4, n)) {
+        lserve_replace(s, w);
+        ljob_finish(s, j, "Sandbox worker ended before taking the request");
+      } else {
+        w->data = j;
+      }
+    } else {
+      double start = lserve_now();
+      lval* x = lval_eval_all(s->vm, c->env,
+        lval_read_all(s->vm, "<request>", (char*)p + 4, n));
+      lval_frame(&c->out, x);
+      lhist_add(&s->h, lserve_now() - start, x->type == LVAL_ERR);
+      lval_del(x);
+    }
+    at += 4 + n;
+  }
+
+  lconn_collect(c);
+  c->held = c->out.len - c->sent >= LSERVE_MAX_PENDING;
+
+  // Keep the start of any request still arriving
+  memmove(c->in.data, c->in.data + at, c->in.len - at);
+  c->in.len -= at;
+  return 1;
+}
+
+// Sends as much of the queued responses as the socket takes. Returns 0 if the
+// connection has failed.
+static int lconn_flush(lconn* c) {
+  while (c->sent < c->out.len) {
+    ssize_t n = send(c->fd, c->out.data + c->sent, c->out.len - c->sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) { continue; }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { break; }
+    if (n < 0) { return 0; }
+    c->sent += n;
+  }
+  if (c->sent == c->out.len) { c->out.len = 0; c->sent = 0; }
+  return 1;
+}
+
+// Reads what has arrived on a connection. Returns 0 if the connection has failed.
+static int lconn_read(lconn* c) {
+  if (c->in.cap - c->in.len < LSERVE_READ) {
+    while (c->in.cap - c->in.len < LSERVE_READ) {
+      c->in.cap = c->in.cap ? c->in.cap * 2 : LSERVE_READ;
+    }
+    c->in.data = realloc(c->in.data, c->in.cap);
+  }
+  ssize_t n = recv(c->fd, c->in.data + c->in.len, LSERVE_READ, 0);
+  if (n < 0) { return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR; }
+  if (n == 0) { c->eof = 1; }
+  c->in.len += n;
+  return 1;
+}
+
+// Closes a connection. Requests still with workers are left to finish on their own.
+static void lserve_close(lserver* s, lconn* c) {
+  for (int i = 0; i < s->nconns; i++) {
+    if (s->conns[i] == c) { s->conns[i] = s->conns[--s->nconns]; break; }
+  }
+  epoll_ctl(s->ep, EPOLL_CTL_DEL, c->fd, NULL);
+  close(c->fd);
+
+  for (ljob* j = c->jobs; j;) {
+    ljob* next = j->next;
+    if (j->done) { free(j->resp.data); free(j); } else { j->c = NULL; }
+    j = next;
+  }
+
+  c->closed = 1;
+  c->next_closed = s->closed;
+  s->closed = c;
+}
+
+// Frees the connections closed since the last call
+static void lserve_free_closed(lserver* s) {
+  while (s->closed) {
+    lconn* c = s->closed;
+    s->closed = c->next_closed;
+    lenv_del(c->env);
+    free(c->in.data);
+    free(c->out.data);
+    free(c);
+  }
+}
+
+// Evaluates and sends whatever a connection is ready for, then watches it for reading
+// while it can take more requests and for writing while responses are waiting. Returns
+// 0 once the connection is finished with.
+static int lconn_service(lserver* s, lconn* c) {
+  // Sending everything makes room for requests that were held back
+  do {
+    if (!lconn_eval(s, c) || !lconn_flush(c)) { return 0; }
+  } while (c->held && c->out.len == 0);
+
+  size_t pending = c->out.len - c->sent;
+  if (c->eof && pending == 0 && !c->jobs && !c->waiting) { return 0; }
+
+  int reading = !c->eof && !c->waiting && pending < LSERVE_MAX_PENDING;
+  unsigned int events = (reading ? EPOLLIN : 0) | (pending ? EPOLLOUT : 0);
+  if (events != c->events) {
+    struct epoll_event ev = { .events = events, .data.ptr = c };
+    epoll_ctl(s->ep, EPOLL_CTL_MOD, c->fd, &ev);
+    c->events = events;
+  }
+  return 1;
+}
+
+// Lets connections waiting for a worker hand it their requests
+static void lserve_waiting(lserver* s) {
+  for (int i = 0; i < s->nconns; i++) {
+    lconn* c = s->conns[i];
+    if (c->waiting && !lconn_service(s, c)) { lserve_close(s, c); i--; }
+  }
+}
+
+// Reads from a worker's result pipe. Once the response is complete, or the worker has
+// died, the worker is replaced and the response queued on its connection. Anything an
+// idle worker writes is dropped, and an event left over from a worker already replaced
+// finds nothing to read.
+static void lserve_worker(lserver* s, lworker* w) {
+  ljob* j = w->data;
+  int died = 0;
+  for (;;) {
+    char buf[LSERVE_READ];
+    ssize_t n = read(w->result, buf, sizeof(buf));
+    if (n < 0 && errno == EINTR) { continue; }
+    if (n < 0) { break; }
+    if (n == 0) { died = 1; break; }
+    if (j) { lbuf_put(&j->resp, buf, n); }
+  }
+
+  int complete = 0;
+  if (j && j->resp.len >= 4) {
+    unsigned char* p = (unsigned char*)j->resp.data;
+    size_t n = p[0] | p[1] << 8 | p[2] << 16 | (size_t)p[3] << 24;
+    complete = j->resp.len == 4 + n;
+  }
+  if (!complete && !died) { return; }
+
+  lserve_replace(s, w);
+  if (!j) { return; }
+
+  if (!complete) { j->resp.len = 0; }
+  ljob_finish(s, j, "Sandbox worker ended without responding");
+
+  lconn* c = j->c;
+  if (!c) {
+    free(j->resp.data);
+    free(j);
+  } else {
+    lconn_collect(c);
+    if (!lconn_service(s, c)) { lserve_close(s, c); }
+  }
+
+  // The worker freed up may take a request that was waiting for one
+  lserve_waiting(s);
+}
+
+// Forks workers again into slots where forking failed, once they have waited long
+// enough. Returns how many milliseconds to wait before trying the rest, or -1 if every
+// slot has a worker.
+static int lserve_respawn(lserver* s) {
+  if (!s->pool) { return -1; }
+  int wait = -1, forked = 0;
+  for (int i = 0; i < s->pool->size; i++) {
+    lworker* w = &s->pool->workers[i];
+    if (w->pid > 0) { continue; }
+    int left = lpool_respawn(s->pool, w);
+    if (left == 0) {
+      lserve_watch(s, w);
+      forked = 1;
+    } else if (wait < 0 || left < wait) {
+      wait = left;
+    }
+  }
+  if (forked) { lserve_waiting(s); }
+  return wait;
+}
+
+int lisp_serve(lisp_vm* vm, const char* path, int sandbox) {
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "Could not serve on %s: path too long\n", path);
+    return 1;
+  }
+  strcpy(addr.sun_path, path);
+
+  // A socket left behind by an earlier server is replaced
+  struct stat st;
+  if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode)) { unlink(path); }
+
+  int lfd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (lfd < 0 || bind(lfd, (struct sockaddr*)&addr, sizeof(addr)) < 0
+      || listen(lfd, SOMAXCONN) < 0) {
+    fprintf(stderr, "Could not serve on %s: %s\n", path, strerror(errno));
+    if (lfd >= 0) { close(lfd); }
+    return 1;
+  }
+
+  // Signals are taken through epoll along with everything else
+  sigset_t mask, old;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGINT);
+  sigaddset(&mask, SIGTERM);
+  sigaddset(&mask, SIGUSR1);
+  sigprocmask(SIG_BLOCK, &mask, &old);
+  int sfd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+
+  lserver s = { .vm = vm, .cap = 16 };
+  s.conns = malloc(sizeof(lconn*) * s.cap);
+  s.ep = epoll_create1(EPOLL_CLOEXEC);
+  struct epoll_event ev = { .events = EPOLLIN, .data.ptr = &lserve_listener };
+  epoll_ctl(s.ep, EPOLL_CTL_ADD, lfd, &ev);
+  ev.data.ptr = &lserve_signals;
+  epoll_ctl(s.ep, EPOLL_CTL_ADD, sfd, &ev);
+
+  // Workers are forked once everything has been loaded
+  if (sandbox >= 0) {
+    s.pool = lpool_new(vm, sandbox);
+    for (int i = 0; i < s.pool->size; i++) { lserve_watch(&s, &s.pool->workers[i]); }
+  }
+  lworker* workers = s.pool ? s.pool->workers : NULL;
+  lworker* workers_end = s.pool ? s.pool->workers + s.pool->size : NULL;
+
+  struct epoll_event events[64];
+  int running = 1;
+  while (running) {
+    // Slots whose fork failed are retried when their backoff is up
+    int n = epoll_wait(s.ep, events, 64, lserve_respawn(&s));
+    if (n < 0 && errno == EINTR) { continue; }
+    if (n < 0) { break; }
+
+    for (int i = 0; i < n && running; i++) {
+      void* tag = events[i].data.ptr;
+
+      if (tag == &lserve_signals) {
+        struct signalfd_siginfo si;
+        while (read(sfd, &si, sizeof(si)) == sizeof(si)) {
+          if (si.ssi_signo == SIGUSR1) { lhist_print(&s.h); } else { running = 0; }
+        }
+      } else if (tag == &lserve_listener) {
+        // Every connection starts in an environment of its own under the globals
+        for (int fd; (fd = accept(lfd, NULL, NULL)) >= 0;) {
+          fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+          fcntl(fd, F_SETFD, FD_CLOEXEC);
+          lconn* c = calloc(1, sizeof(lconn));
+          c->fd = fd;
+          c->env = lenv_new();
+          c->env->par = vm->env;
+          c->events = EPOLLIN;
+          struct epoll_event cev = { .events = EPOLLIN, .data.ptr = c };
+          epoll_ctl(s.ep, EPOLL_CTL_ADD, fd, &cev);
+          if (s.nconns == s.cap) {
+            s.cap *= 2;
+            s.conns = realloc(s.conns, sizeof(lconn*) * s.cap);
+          }
+          s.conns[s.nconns++] = c;
+        }
+      } else if ((lworker*)tag >= workers && (lworker*)tag < workers_end) {
+        lserve_worker(&s, tag);
+      } else {
+        lconn* c = tag;
+        if (c->closed) { continue; }
+        int ok = !(events[i].events & EPOLLIN) || lconn_read(c);
+        if (events[i].events & (EPOLLERR | EPOLLHUP) && !(events[i].events & EPOLLIN)) {
+          ok = 0;
+        }
+        if (!ok || !lconn_service(&s, c)) { lserve_close(&s, c); }
+      }
+    }
+    lserve_free_closed(&s);
+  }
+
+  lhist_print(&s.h);
+  while (s.nconns) { lserve_close(&s, s.conns[0]); }
+  lserve_free_closed(&s);
+  if (s.pool) {
+    // Requests still with workers are abandoned along with them
+    for (int i = 0; i < s.pool->size; i++) {
+      ljob* j = s.pool->workers[i].data;
+      if (j) { free(j->resp.data); free(j); }
+    }
+    lpool_del(s.pool);
+  }
+  free(s.conns);
+  close(s.ep);
+  close(sfd);
+  close(lfd);
+  unlink(path);
+  sigprocmask(SIG_SETMASK, &old, NULL);
+  return 0;
+}
+
+#else
+
+int lisp_serve(lisp_vm* vm, const char* path, int sandbox) {
+  fprintf(stderr, "Could not serve on %s: only supported on Linux\n", path);
+  return 1;
+}
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef server_h
+#define server_h
+
+#include "vm.h"
+#include "cache.h"
+
+// Serves requests on a Unix domain socket until interrupted, returning the exit status.
+// With `sandbox` at 0 or more, requests are evaluated by that many forked workers, 0
+// being one per core.
+int lisp_serve(lisp_vm* vm, const char* path, int sandbox);
+
+// Appends the response frame for the result of a request
+void lval_frame(lbuf* out, lval* x);
+
+#endif
@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vm.h"
+#include "builtin.h"
+#include "jit.h"
+
+/*
+ * Interpreters. Everything evaluation changes lives in a lisp_vm rather than in
+ * globals: the global environment, the mpc parsers, the epoch bindings are checked
+ * against, the table of compiled lambdas and the counts in lisp_stats. Each is passed
+ * down through lval_eval to every builtin, so several interpreters can run in one
+ * process at once, one per thread, as long as no lval is shared between them.
+ */
+
+// Creates an interpreter whose global environment holds only the builtins, or returns
+// NULL if there is no memory for one. Its parsers are only built when first needed, and
+// if they cannot be, reading through them gives an error.
+lisp_vm* lisp_vm_new(void) {
+  lisp_vm* vm = calloc(1, sizeof(lisp_vm));
+  if (!vm) { return NULL; }
+  vm->env = lenv_new();
+  lenv_add_builtins(vm->env);
+  vm->jit = jit_new();
+  vm->use_jit = 1;
+  return vm;
+}
+
+// Frees an interpreter and everything it owns
+void lisp_vm_del(lisp_vm* vm) {
+  if (vm->env) { lenv_del(vm->env); }
+  jit_del(vm->jit);
+  lispy_del(vm);
+  free(vm);
+}
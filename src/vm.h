@@ -0,0 +1,54 @@
+#ifndef vm_h
+#define vm_h
+
+#include "lval.h"
+
+struct jit_state;
+
+// Counts of what an interpreter has done, printed on exit with LISPERERS_STATS set
+typedef struct {
+  unsigned long calls;
+  unsigned long inlined;
+  unsigned long native;
+  unsigned long compiled;
+} lisp_stats;
+
+// An interpreter, passed to every builtin. Interpreters share nothing they change, so
+// each can run on its own thread.
+struct lisp_vm {
+  // Global environment, starting out with the builtins
+  lenv* env;
+
+  // Parsers of the mpc grammar, built the first time anything is read through it
+  mpc_parser_t* Number;
+  mpc_parser_t* Symbol;
+  mpc_parser_t* String;
+  mpc_parser_t* Comment;
+  mpc_parser_t* Sexpr;
+  mpc_parser_t* Qexpr;
+  mpc_parser_t* Expr;
+  mpc_parser_t* Lispy;
+
+  // Bumped whenever a binding is replaced or defined by `def`/`=`, so that
+  // call sites which inlined a global can tell it may have changed
+  unsigned long epoch;
+
+  // Lambdas compiled to native code and the state that code runs with
+  struct jit_state* jit;
+
+  // Whether to read through mpc and to compile hot lambdas, and the threads to read
+  // large files with, 0 being one per core
+  int use_mpc;
+  int use_jit;
+  int read_threads;
+
+  lisp_stats stats;
+
+  // Left to a program embedding the interpreter, see lisperers.h
+  void* user;
+};
+
+lisp_vm* lisp_vm_new(void);
+void lisp_vm_del(lisp_vm* vm);
+
+#endif
@@ -0,0 +1,12 @@
+#!/bin/sh
+# Deeply nested expressions must be written to and read back from the cache without
+# overflowing the C stack.
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+awk 'BEGIN { for (i = 0; i < 100000; i++) printf "{"; for (i = 0; i < 100000; i++) printf "}"
+  print "\n(print 1)" }' > "$tmp/deep.lspy"
+
+[ "$("$LISPERERS" "$tmp/deep.lspy")" = "1 " ] || exit 1
+[ -f "$tmp/deep.lspc" ] || exit 1
+[ "$("$LISPERERS" "$tmp/deep.lspy")" = "1 " ]
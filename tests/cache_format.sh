@@ -0,0 +1,16 @@
+#!/bin/sh
+# A .lspc written with another cache format must be read from source again, and replaced.
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+echo '(print (+ 1 2))' > "$tmp/f.lspy"
+
+# The format follows "LSPC" and the version, a 4 byte length and its 3 bytes
+format() { od -An -tu1 -j11 -N4 "$tmp/f.lspc"; }
+
+"$LISPERERS" "$tmp/f.lspy" > /dev/null || exit 1
+want=$(format)
+printf '\377\377\377\377' | dd of="$tmp/f.lspc" bs=1 seek=11 conv=notrunc 2> /dev/null
+
+[ "$("$LISPERERS" "$tmp/f.lspy")" = "3 " ] || exit 1
+[ "$(format)" = "$want" ]
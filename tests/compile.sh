@@ -0,0 +1,26 @@
+#!/bin/sh
+# A script compiled with lisperers-compile must print what the interpreter prints for
+# it, with the JIT or not, both for fib from the prelude and a fib compiled to C.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+src=$dir/../src
+lib="vm.c lval.c lenv.c cache.c reader.c builtin.c image.c jit.c lisperers.c server.c pool.c mpc.c"
+cd "$src" && gcc compile.c $lib -lm -pthread -o "$tmp/compile" || exit 1
+
+cat > "$tmp/fib.lspy" <<LSPY
+(load "$PRELUDE")
+(fun {nfib n} {if (< n 2) {n} {+ (nfib (- n 1)) (nfib (- n 2))}})
+(print (nfib 25))
+(print (fib 15))
+(print (map nfib {1 2 3 4 5 6 7 8 9 10}))
+LSPY
+"$tmp/compile" "$tmp/fib.lspy" "$tmp/fib.c" || exit 1
+grep -q 'jit_register(vm, lval_add(lval_qexpr(), lval_sym("n"))' "$tmp/fib.c" || exit 1
+gcc -I"$src" "$tmp/fib.c" $lib -lm -pthread -o "$tmp/fib" || exit 1
+
+"$LISPERERS" "$tmp/fib.lspy" > "$tmp/expected" || exit 1
+"$tmp/fib" > "$tmp/out" && diff "$tmp/expected" "$tmp/out" || exit 1
+LISPERERS_NOJIT=1 "$tmp/fib" > "$tmp/out" && diff "$tmp/expected" "$tmp/out"
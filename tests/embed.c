@@ -0,0 +1,67 @@
+/*
+ * Embeds the interpreter through lisperers.h alone, as a program linked against
+ * liblisperers.so would, and prints what each call gives for embed.sh to compare.
+ */
+
+#include <stdio.h>
+
+#include "lisperers.h"
+
+// Doubles its argument, counting its calls in the program's state
+static lval* twice(lisp_vm* vm, lenv* e, lval* a) {
+  (void)e;
+  int* calls = lisp_user(vm);
+  (*calls)++;
+  if (lisp_count(a) != 1 || lisp_type(lisp_item(a, 0)) != LISP_NUM) {
+    lval_del(a);
+    return lval_err("twice takes one number");
+  }
+  lval* x = lval_num(lisp_number(lisp_item(a, 0)) * 2);
+  lval_del(a);
+  return x;
+}
+
+static void print(const char* what, lval* x) {
+  switch (lisp_type(x)) {
+    case LISP_NUM: printf("%s: %ld\n", what, lisp_number(x)); break;
+    case LISP_ERR: printf("%s: error %s\n", what, lisp_string(x)); break;
+    default: printf("%s: type %d, %d items\n", what, lisp_type(x), lisp_count(x)); break;
+  }
+  lval_del(x);
+}
+
+int main(void) {
+  lisp_vm* vm = lisp_vm_new();
+  if (!vm) { return 1; }
+  int calls = 0;
+  lisp_set_user(vm, &calls);
+  lisp_register_builtin(vm, "twice", twice);
+  lisp_define(vm, "base", lval_num(100));
+
+  print("define", lisp_eval_string(vm, "(def {sq} (\\ {x} {* x x}))"));
+  print("eval", lisp_eval_string(vm, "(+ base (sq 3))"));
+  print("error", lisp_eval_string(vm, "(twice {1})"));
+  print("list", lisp_eval_string(vm, "{1 2 3}"));
+
+  // Each run binds its own arguments, which are gone once it returns
+  const char* params[] = { "a", "b" };
+  lisp_prepared* p = lisp_prepare(vm, "(+ base (sq a) (twice b))", 2, params);
+  for (long i = 1; i <= 3; i++) {
+    lval* args[] = { lval_num(i), lval_num(i * 10) };
+    char what[16];
+    snprintf(what, sizeof(what), "run %ld", i);
+    print(what, lisp_run(vm, p, args));
+    lval_del(args[0]);
+    lval_del(args[1]);
+  }
+  lisp_prepared_del(p);
+  print("after", lisp_eval_string(vm, "a"));
+
+  p = lisp_prepare(vm, "(+ 1", 0, NULL);
+  print("unread", lisp_run(vm, p, NULL));
+  lisp_prepared_del(p);
+
+  printf("twice called %d times\n", calls);
+  lisp_vm_del(vm);
+  return 0;
+}
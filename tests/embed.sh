@@ -0,0 +1,17 @@
+#!/bin/sh
+# A program embedding liblisperers.so through lisperers.h must get the results in
+# embed.out, and the library must export nothing but that interface.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+src=$dir/../src
+cd "$src" && gcc -shared -fPIC -fvisibility=hidden vm.c lval.c lenv.c cache.c reader.c \
+  builtin.c image.c jit.c lisperers.c server.c pool.c mpc.c -lm -pthread \
+  -o "$tmp/liblisperers.so" || exit 1
+gcc -I"$src" "$dir/embed.c" -L"$tmp" -llisperers -o "$tmp/embed" || exit 1
+
+nm -D --defined-only "$tmp/liblisperers.so" | awk '{ print $3 }' | grep -v '^lisp_\|^lval_' \
+  && exit 1
+LD_LIBRARY_PATH=$tmp "$tmp/embed" > "$tmp/out" && diff "$dir/embed.out" "$tmp/out"
@@ -0,0 +1,7 @@
+#!/bin/sh
+# jit.lspy, which run.sh checks gives jit.out with and without the JIT, must actually
+# have its lambdas compiled and run as native code when the JIT is on.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+stats=$(LISPERERS_STATS=1 "$LISPERERS" -l "$PRELUDE" "$dir/jit.lspy" 2>&1 >/dev/null)
+echo "$stats" | grep -q "native: [1-9][0-9]*, compiled: 4$" || { echo "$stats"; exit 1; }
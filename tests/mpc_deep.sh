@@ -0,0 +1,9 @@
+#!/bin/sh
+# A failing parse through mpc must take time linear in how deeply its input nests.
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+printf '%0200d1\n' 0 | tr 0 '(' > "$tmp/deep.lspy"
+
+out=$(LISPERERS_MPC=1 timeout 5 "$LISPERERS" "$tmp/deep.lspy" 2>&1)
+[ $? != 124 ] && echo "$out" | grep -q "error: expected"
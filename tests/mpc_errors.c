@@ -0,0 +1,84 @@
+/*
+ * Prints the error mpc gives for each of a set of inputs to grammars other than Lispy,
+ * read from a string and from a file, for mpc_errors.sh to compare.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc.h"
+
+static void check(mpc_parser_t* p, const char* input) {
+  mpc_result_t r;
+  if (mpc_parse("<in>", input, p, &r)) {
+    printf("%s\n  ok\n", input);
+    mpc_ast_delete(r.output);
+    return;
+  }
+  char* s = mpc_err_string(r.error);
+  printf("%s\n  %s", input, s);
+  mpc_err_delete(r.error);
+
+  FILE* f = tmpfile();
+  fputs(input, f);
+  rewind(f);
+  if (mpc_parse_file("<in>", f, p, &r)) {
+    printf("  file: ok\n");
+    mpc_ast_delete(r.output);
+  } else {
+    char* t = mpc_err_string(r.error);
+    if (strcmp(s, t) != 0) { printf("  file: %s", t); }
+    free(t);
+    mpc_err_delete(r.error);
+  }
+  fclose(f);
+  free(s);
+}
+
+int main(void) {
+  mpc_parser_t* W = mpc_new("w");
+  mpc_parser_t* F = mpc_new("f");
+  mpc_parser_t* T = mpc_new("t");
+  mpc_parser_t* E = mpc_new("e");
+  mpc_parser_t* S = mpc_new("s");
+  mpc_err_t* err = mpca_lang(MPCA_LANG_DEFAULT,
+    " w : /[a-z]+/ ;"
+    " f : /[0-9]+(\\.[0-9]*)?/ | '(' <e> ')' | <w> ;"
+    " t : <f> (('*' | '/') <f>)* ;"
+    " e : <t> (('+' | '-') <t>)* ;"
+    " s : /^/ <e> /$/ ;",
+    W, F, T, E, S, NULL);
+  if (err) { mpc_err_print(err); return 1; }
+
+  mpc_parser_t* B = mpc_new("b");
+  mpc_parser_t* Byte = mpc_new("byte");
+  mpc_parser_t* Word = mpc_new("word");
+  mpc_parser_t* Ws = mpc_new("ws");
+  mpc_parser_t* Kw = mpc_new("kw");
+  mpc_parser_t* Top = mpc_new("top");
+  err = mpca_lang(MPCA_LANG_DEFAULT,
+    " b : /[01]/ ;"
+    " byte : <b>{8} ;"
+    " word : <byte>{2} | 'x' <b>+ ;"
+    " ws : /[a-c]+|[d-f]{2}/ ;"
+    " kw : \"let\" <ws> '=' <word> | /[g-h]{2}x?/+ ;"
+    " top : /^/ (<word> | <ws>+ ';' | <kw>)+ /$/ ;",
+    B, Byte, Word, Ws, Kw, Top, NULL);
+  if (err) { mpc_err_print(err); return 1; }
+
+  const char* arith[] = {
+    "9+ -", "(", "", "-4.5(@", "9(x*-*", "4.512/x*(*", "3./x*x*12--/@", "x3.12)4.59",
+    "(4.59*xx*))ab", "12*(3+x)", NULL
+  };
+  const char* counts[] = {
+    "11ghdefgh;ghletdegh", "01010101f=xde", "x01010101=", "01010101a=ghdex", "ghde;letbcf",
+    "01010101111", "bcbcfletf", " debchhletlet0=bc", "hh010101011=ghxbc", "let de=x01", NULL
+  };
+  for (int i = 0; arith[i]; i++) { check(S, arith[i]); }
+  for (int i = 0; counts[i]; i++) { check(Top, counts[i]); }
+
+  mpc_cleanup(5, W, F, T, E, S);
+  mpc_cleanup(6, B, Byte, Word, Ws, Kw, Top);
+  return 0;
+}
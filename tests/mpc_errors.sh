@@ -0,0 +1,10 @@
+#!/bin/sh
+# mpc's errors for grammars other than Lispy, with regexes under repeats and counts, must
+# be the ones in mpc_errors.out, which mpc gave before it kept only the farthest failure.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+gcc -I"$dir/../src" "$dir/mpc_errors.c" "$dir/../src/mpc.c" -lm -o "$tmp/mpc_errors" || exit 1
+"$tmp/mpc_errors" > "$tmp/out" && diff "$dir/mpc_errors.out" "$tmp/out"
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Runs the tests in this directory against an interpreter, by default the one built in
+# src. NAME.lspy is run after the prelude, with and without the JIT, and its output must
+# match NAME.out. NAME.sh is run with $LISPERERS and $PRELUDE set, and must exit 0.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+LISPERERS=${1:-$dir/../src/main}
+case $LISPERERS in /*) ;; *) LISPERERS=$(pwd)/$LISPERERS ;; esac
+PRELUDE=$dir/../resources/prelude.lspy
+export LISPERERS PRELUDE
+
+failed=0
+for t in "$dir"/*.lspy; do
+  for jit in "" 1; do
+    out=$(LISPERERS_NOJIT=$jit "$LISPERERS" -l "$PRELUDE" "$t" 2>&1)
+    if [ "$out" != "$(cat "${t%.lspy}.out")" ]; then
+      echo "FAIL $(basename "$t")${jit:+ (no JIT)}"
+      echo "$out"
+      failed=1
+    fi
+  done
+done
+for t in "$dir"/*.sh; do
+  [ "$t" = "$dir/run.sh" ] && continue
+  if ! sh "$t"; then
+    echo "FAIL $(basename "$t")"
+    failed=1
+  fi
+done
+
+[ $failed = 0 ] && echo "All tests passed"
+exit $failed
@@ -0,0 +1,26 @@
+#!/bin/sh
+# With --sandbox, a request that crashes its worker must get an error back, and the
+# requests after it must still be answered, in order, each from the globals as loaded.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'kill $pid 2>/dev/null; rm -rf "$tmp"' EXIT
+
+gcc "$dir/serve_client.c" -o "$tmp/client" || exit 1
+"$LISPERERS" -l "$PRELUDE" --serve "$tmp/sock" --sandbox 2 2>/dev/null &
+pid=$!
+
+# f recurses until the worker runs out of stack
+"$tmp/client" "$tmp/sock" '(def {z} 1) z' 'z' \
+  '(def {f} (\ {x} {join {1} (f x)})) (f {1})' '(+ 2 3)' '(fib 10)' '(def {z} 2) z' \
+  '(- 9 1)' > "$tmp/out" || exit 1
+cat > "$tmp/expected" <<'OUT'
+0 1
+1 Unbound Symbol 'z'
+1 Sandbox worker ended without responding
+0 5
+0 55
+0 2
+0 8
+OUT
+diff "$tmp/expected" "$tmp/out"
@@ -0,0 +1,25 @@
+#!/bin/sh
+# A server started with --serve must answer requests a client sends without waiting in
+# the order they were sent, keep what they bind across requests and report errors.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'kill $pid 2>/dev/null; rm -rf "$tmp"' EXIT
+
+gcc "$dir/serve_client.c" -o "$tmp/client" || exit 1
+"$LISPERERS" -l "$PRELUDE" --serve "$tmp/sock" 2>/dev/null &
+pid=$!
+
+"$tmp/client" "$tmp/sock" '(def {x} 5) x' '(fib 15)' '(+ x 1)' '(+ 1' '(head {})' \
+  '(= {y} 2) y' '(* x y)' '(fib 5)' > "$tmp/out" || exit 1
+cat > "$tmp/expected" <<'OUT'
+0 5
+0 610
+0 6
+1 <request>:1:5: error: expected ')' to close list opened at 1:1
+1 Function 'head' passed {} for argument 0.
+0 2
+0 10
+0 5
+OUT
+diff "$tmp/expected" "$tmp/out"
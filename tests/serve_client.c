@@ -0,0 +1,67 @@
+/*
+ * Client for the evaluation server, for serve.sh and sandbox.sh. It connects to the
+ * socket given, waiting for the server to create it, sends every request given at once
+ * without waiting for responses, then prints each response in the order it comes back:
+ * its status byte and its text.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static int write_all(int fd, const void* buf, size_t n) {
+  for (size_t done = 0; done < n;) {
+    ssize_t w = write(fd, (const char*)buf + done, n - done);
+    if (w <= 0) { return 0; }
+    done += w;
+  }
+  return 1;
+}
+
+static int read_all(int fd, void* buf, size_t n) {
+  for (size_t got = 0; got < n;) {
+    ssize_t r = read(fd, (char*)buf + got, n - got);
+    if (r <= 0) { return 0; }
+    got += r;
+  }
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s SOCKET REQUEST...\n", argv[0]);
+    return 1;
+  }
+
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  strncpy(addr.sun_path, argv[1], sizeof(addr.sun_path) - 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  int tries = 0;
+  while (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+    if (++tries == 500) { perror("connect"); return 1; }
+    usleep(10000);
+  }
+
+  for (int i = 2; i < argc; i++) {
+    unsigned int n = strlen(argv[i]);
+    unsigned char len[4] = { n, n >> 8, n >> 16, n >> 24 };
+    if (!write_all(fd, len, 4) || !write_all(fd, argv[i], n)) { perror("write"); return 1; }
+  }
+
+  for (int i = 2; i < argc; i++) {
+    unsigned char len[4];
+    if (!read_all(fd, len, 4)) { fprintf(stderr, "no response to request %d\n", i - 1); return 1; }
+    unsigned int n = len[0] | len[1] << 8 | len[2] << 16 | (unsigned int)len[3] << 24;
+    char* body = malloc(n + 1);
+    if (n == 0 || !read_all(fd, body, n)) { fprintf(stderr, "short response\n"); return 1; }
+    body[n] = '\0';
+    printf("%d %s\n", body[0], body + 1);
+    free(body);
+  }
+
+  close(fd);
+  return 0;
+}